@@ -3,6 +3,24 @@
 
 #include <FastLED.h>
 #include <vector>
+#include "render/RenderPasses.h"
+#include "render/NoiseField.h"
+#include "render/PaletteGather.h"
+#include "render/HsvKernels.h"
+#include "effects/ParticlePool.h"
+#include "effects/HeatField.h"
+#include "effects/WaveBank.h"
+#include "effects/CometTrails.h"
+#include "effects/SparkleField.h"
+#include "effects/RippleField.h"
+#include "effects/Automaton.h"
+#include "palettes/PaletteService.h"
+#include "TimeMotion.h"
+#include "TimerWheel.h"
+#include "RandomStream.h"
+#include "FrameContext.h"
+#include "../utils/FixedMath.h"
+#include "../diagnostics/Profiler.h"
 
 // Define qsuba macro if not already defined
 #ifndef qsuba
@@ -22,23 +40,108 @@ public:
     Animation(CRGB* ledArray, uint16_t numLeds, const char* animName = "Unnamed")
         : leds(ledArray),
           numLeds(numLeds),
+          outputLeds(numLeds),
           name(animName),
           brightness(128),
-          colorModifier(128) {}
+          colorModifier(128),
+          renderStride(1),
+          subResolutionCapable(false),
+          symmetry(Render::Symmetry::NONE),
+          keyframeIntervalMs(0),
+          rng(random16_get_seed()) {}
 
     virtual ~Animation() {}
 
-    virtual void update() = 0;
+    // frame: timing shared by every pixel and animation this frame. Advance
+    // state by frame.deltaMs, not per call, so the look doesn't change with the
+    // frame rate (see TimeMotion.h), and read time and beats from frame
+    // rather than millis()/beatsin8(). random8()/random16() draw from this
+    // animation's own stream (see RandomStream.h).
+    virtual void update(const FrameContext& frame) = 0;
+
+    // Renders one frame: update() on the unique segment, then the output pass
+    void renderFrame(const FrameContext& frame) {
+        PROFILE_ZONE(name);
+        RandomStream::Scope dice(rng);
+        update(frame);
+        Render::replicateSymmetry(leds, numLeds, outputLeds, symmetry);
+    }
     virtual const char* getName() const { return name; }
     virtual void setBrightness(uint8_t value) { brightness = value; }
     virtual void setColorModifier(uint8_t value) { colorModifier = value; }
 
+    // Sparse looks report the pixels the last update() wrote. Returns false
+    // when unknown, in which case every pixel may have changed.
+    virtual bool changedPixels(const uint16_t*&, uint16_t&) const { return false; }
+
+    // Sub-resolution rendering (only honoured by animations that opted in)
+    void setRenderStride(uint8_t stride) {
+        if (subResolutionCapable) renderStride = stride ? stride : 1;
+    }
+    uint8_t getRenderStride() const { return renderStride; }
+    bool supportsSubResolution() const { return subResolutionCapable; }
+
+    // State of the animation's random stream; with the same state and frame
+    // times, renderFrame() produces the same frames
+    void setRandomState(uint16_t state) { rng.setState(state); }
+    uint16_t getRandomState() const { return rng.state(); }
+
+    // Keyframe mode: 0 means the animation renders every display frame
+    uint16_t getKeyframeInterval() const { return keyframeIntervalMs; }
+    // Points rendering at a buffer owned by the output stage (keyframe mode)
+    void setRenderBuffer(CRGB* buffer) { leds = buffer; }
+
 protected:
     CRGB* leds;
-    uint16_t numLeds;
+    uint16_t numLeds;     // LEDs the animation renders (unique segment when symmetric)
+    uint16_t outputLeds;  // LEDs on the strip
 const char* name;
     uint8_t brightness;
     uint8_t colorModifier;
+    uint8_t renderStride;
+    bool subResolutionCapable;
+    Render::Symmetry symmetry;
+    uint16_t keyframeIntervalMs;
+    RandomStream rng;
+
+    // Opt in to low-rate rendering: update() runs once per intervalMs and the
+    // output stage interpolates the frames in between. Only for slow looks;
+    // fast motion turns into a crossfade.
+    void enableKeyframes(uint16_t intervalMs) { keyframeIntervalMs = intervalMs; }
+
+    // Declare a symmetric layout. Call from the constructor: numLeds shrinks to
+    // the unique segment, so update() only ever touches that part and
+    // renderFrame() replicates it over the whole strip.
+    void setSymmetry(Render::Symmetry mode) {
+        symmetry = mode;
+        numLeds = Render::uniqueLength(outputLeds, mode);
+    }
+
+    // Opt in to sub-resolution rendering: renderPixels() will only evaluate
+    // every `stride`-th pixel and upscale the rest. Meant for smooth,
+    // low-frequency looks where neighbouring pixels barely differ.
+    void enableSubResolution(uint8_t stride) {
+        subResolutionCapable = true;
+        renderStride = stride ? stride : 1;
+    }
+
+    // Writes pixelAt(i) for every LED, or for every renderStride-th LED plus
+    // the last one followed by a linear upscale when sub-resolution is active.
+    template <typename PixelFn>
+    void renderPixels(PixelFn pixelAt) {
+        if (renderStride <= 1 || numLeds <= renderStride) {
+            for (uint16_t i = 0; i < numLeds; i++) {
+                leds[i] = pixelAt(i);
+            }
+            return;
+        }
+        const uint16_t last = numLeds - 1;
+        for (uint16_t i = 0; i < last; i += renderStride) {
+            leds[i] = pixelAt(i);
+        }
+        leds[last] = pixelAt(last);
+        Render::upscaleLinear(leds, numLeds, renderStride);
+    }
 
     void addGlitter(fract8 chanceOfGlitter) {
         if (random8() < chanceOfGlitter) {
@@ -69,4 +172,17 @@ struct Registrar {
     }
 };
 
+// Constructs an animation inside its own random stream, so whatever the
+// constructor rolls is reproducible from seed as well
+inline Animation* createSeeded(const AnimationInfo& info, CRGB* leds, uint16_t numLeds, uint16_t seed) {
+    RandomStream stream(seed);
+    Animation* anim;
+    {
+        RandomStream::Scope dice(stream);
+        anim = info.createFn(leds, numLeds);
+    }
+    if (anim) anim->setRandomState(stream.state());
+    return anim;
+}
+
 #endif // ANIMATION_BASE_H
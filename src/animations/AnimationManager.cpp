@@ -17,10 +17,13 @@ std::vector<AnimationInfo> globalAnimationRegistry;
 
 AnimationManager::AnimationManager(SystemManager& systemManager, CRGB* leds) : systemManager(systemManager), leds(leds), numLeds(DEFAULT_NUM_LEDS),
       brightness(DEFAULT_BRIGHTNESS), currentPatternIndex(0), currentAnimation(nullptr),
-      isInitialized(false), currentShuffleIndex(0), lastShuffleTime(0), inShuffleTransition(false), shuffleTransitionStart(0), shuffleTransitionNewIndex(0), currentShuffleDuration(SHUFFLE_DURATION) {
+      isInitialized(false), keyframeElapsed(0), keyframePrimed(false), currentShuffleIndex(0), lastShuffleTime(0), inShuffleTransition(false), shuffleTransitionStart(0), shuffleTransitionNewIndex(0), currentShuffleDuration(SHUFFLE_DURATION), lastFrameTime(0), triggerPending(false),
+      clock(millis), seedBase(esp_random()), instanceCount(0), persistSettings(true) {
 
     memset(oldLedsBuffer, 0, sizeof(oldLedsBuffer));
     memset(tempLeds, 0, sizeof(tempLeds));
+    fill_solid(keyframePrev, MAX_LEDS, CRGB::Black);
+    fill_solid(keyframeNext, MAX_LEDS, CRGB::Black);
 
     Serial.print(F("AnimationManager constructor - LED array at: 0x"));
     Serial.println(reinterpret_cast<uintptr_t>(leds), HEX);
@@ -82,7 +85,8 @@ void AnimationManager::begin() {
 
      if (currentAnimation) {
         currentAnimation->setBrightness(brightness);
-        currentAnimation->update();
+        advanceFrame();
+        renderCurrentAnimation(ANIMATION_UPDATE_INTERVAL);
     }
 
     isInitialized = true;
@@ -90,7 +94,12 @@ void AnimationManager::begin() {
 }
 
 void AnimationManager::update() {
+    PROFILE_ZONE("manager.update");
     bool skipAnimationUpdate = false;
+    // Measured every call so frames skipped by transitions don't pile up into one step
+    advanceFrame();
+    // Palette fades run on the same clock whether or not this frame renders
+    PaletteService::tick(frame.deltaMs);
 
     if (!isInitialized) {
         EVERY_N_SECONDS(5) { Serial.println(F("Animation not initialized")); }
@@ -111,18 +120,23 @@ void AnimationManager::update() {
 
     // Shuffle mode logic
     if (inShuffleMode()) {
-        if (!lastShuffleTime || millis() - lastShuffleTime > currentShuffleDuration) {
+        if (!lastShuffleTime || frame.nowMs - lastShuffleTime > currentShuffleDuration) {
+            PROFILE_ZONE("manager.shuffle");
             pickNewShuffle();
         }
         if (inShuffleTransition) {
-            uint32_t elapsed = millis() - shuffleTransitionStart;
+            uint32_t elapsed = frame.nowMs - shuffleTransitionStart;
             if (elapsed >= shuffleTransitionDuration) {
                 inShuffleTransition = false;
+                // Hand the new animation back its own frame: sparse renderers
+                // only redraw what they changed, so the blend must not linger
+                memcpy(leds, tempLeds, sizeof(CRGB) * numLeds);
             } else {
                 float progress = (float)elapsed / shuffleTransitionDuration;
                 for (uint16_t i = 0; i < numLeds; i++) {
                     leds[i] = blend(oldLedsBuffer[i], tempLeds[i], progress * 255);
                 }
+                #if ENABLE_STATUS_LOGS
                 EVERY_N_SECONDS(5) {
                     Serial.print(F("[DEBUG] shuffleTransition progress: "));
                     Serial.print(progress * 100);
@@ -134,6 +148,7 @@ void AnimationManager::update() {
                     Serial.print(F(" B:"));
                     Serial.println(leds[0].b);
                 }
+                #endif
                 skipAnimationUpdate = true;
             }
         }
@@ -142,7 +157,8 @@ void AnimationManager::update() {
     // Normal animation update (only if not skipping)
     if (!skipAnimationUpdate) {
         try {
-            currentAnimation->update();
+            renderCurrentAnimation(frame.deltaMs);
+            #if ENABLE_STATUS_LOGS
             EVERY_N_SECONDS(10) {
                 Serial.print(F("[DEBUG] Post-update sample LED[0] for "));
                 Serial.print(currentAnimation->getName());
@@ -152,7 +168,16 @@ void AnimationManager::update() {
                 Serial.print(leds[0].g);
                 Serial.print(F(" B:"));
                 Serial.println(leds[0].b);
+                const uint16_t* changed;
+                uint16_t changedCount;
+                if (currentAnimation->changedPixels(changed, changedCount)) {
+                    Serial.print(F("[DEBUG] Pixels changed last frame: "));
+                    Serial.print(changedCount);
+                    Serial.print(F(" / "));
+                    Serial.println(numLeds);
+                }
             }
+            #endif
         } catch (...) {
             Serial.print(F("[CRITICAL] Crash in animation update() for "));
             Serial.println(currentAnimation->getName());
@@ -168,6 +193,65 @@ void AnimationManager::update() {
     #endif
 }
 
+void AnimationManager::renderCurrentAnimation(uint32_t deltaMs) {
+    FrameContext step = frame;
+    step.deltaMs = deltaMs;
+    const uint16_t interval = currentAnimation->getKeyframeInterval();
+    if (interval == 0) {
+        currentAnimation->renderFrame(step);
+        triggerPending = false;
+        return;
+    }
+
+    // Render a new keyframe once the previous one has been fully shown. The
+    // overshoot carries into the next keyframe so they keep the nominal rate;
+    // after a stall the backlog is dropped rather than queued.
+    keyframeElapsed += deltaMs;
+    if (!keyframePrimed || keyframeElapsed >= interval) {
+        memcpy(keyframePrev, keyframeNext, sizeof(CRGB) * numLeds);
+        const bool stalled = keyframeElapsed >= 2u * interval;
+        if (keyframePrimed) step.deltaMs = stalled ? std::min<uint32_t>(keyframeElapsed, MAX_FRAME_DELTA_MS) : interval;
+        currentAnimation->renderFrame(step);
+        triggerPending = false;
+        if (!keyframePrimed) {
+            memcpy(keyframePrev, keyframeNext, sizeof(CRGB) * numLeds);
+            keyframePrimed = true;
+            keyframeElapsed = 0;
+        } else {
+            keyframeElapsed = stalled ? 0 : keyframeElapsed - interval;
+        }
+    }
+
+    // Output stage: fixed-point lerp between the last two keyframes
+    const fract8 frac = std::min<uint32_t>(255, keyframeElapsed * 256 / interval);
+    Render::interpolateFrames(leds, keyframePrev, keyframeNext, numLeds, frac);
+}
+
+void AnimationManager::setClock(Clock source) {
+    clock = source ? source : millis;
+    lastFrameTime = 0; // Next frame runs one nominal step instead of a jump
+}
+
+void AnimationManager::setRandomSeed(uint16_t seed) {
+    seedBase = seed;
+    instanceCount = 0;
+    random16_set_seed(seed); // Shuffle picks
+    Serial.print(F("Random seed: 0x")); Serial.println(seed, HEX);
+}
+
+void AnimationManager::advanceFrame() {
+    unsigned long now = clock();
+    uint32_t delta = lastFrameTime ? now - lastFrameTime : ANIMATION_UPDATE_INTERVAL;
+    lastFrameTime = now;
+    frame.nowMs = now;
+    frame.deltaMs = std::min<uint32_t>(delta, MAX_FRAME_DELTA_MS);
+    frame.frameCount++;
+    // Stays set until a frame renders (see renderCurrentAnimation), so a hit
+    // landing in a shuffle transition or between keyframes isn't lost
+    frame.onTrigger = triggerPending;
+    tempo.advance(frame);
+}
+
 void AnimationManager::logFastLEDDiagnostics() {
     EVERY_N_MILLISECONDS(1000) {
         if (leds == nullptr) {
@@ -197,6 +281,9 @@ void AnimationManager::logFastLEDDiagnostics() {
             Serial.println(F("[CRITICAL] Heap memory low! Risk of crashes."));
         }
     }
+    #if ENABLE_STATUS_LOGS
+    EVERY_N_SECONDS(30) { PaletteService::printStats(); }
+    #endif
 }
 
 void AnimationManager::registerAnimations() {
@@ -245,12 +332,14 @@ void AnimationManager::setCurrentPattern(uint8_t index) {
         Serial.println(F("ERROR: No animations registered"));
         currentAnimation = nullptr;
         currentPatternIndex = 0;
-        Preferences prefs;
-        prefs.begin(Config::PREF_NAMESPACE, false);
-        if (prefs.putUChar(Config::PREF_PATTERN_KEY, 0) == 0) {
-            Serial.println(F("[ERROR] Failed to save pattern index 0"));
+        if (persistSettings) {
+            Preferences prefs;
+            prefs.begin(Config::PREF_NAMESPACE, false);
+            if (prefs.putUChar(Config::PREF_PATTERN_KEY, 0) == 0) {
+                Serial.println(F("[ERROR] Failed to save pattern index 0"));
+            }
+            prefs.end();
         }
-        prefs.end();
         return;
     }
 
@@ -258,14 +347,16 @@ void AnimationManager::setCurrentPattern(uint8_t index) {
 
     createAnimation(inShuffleMode() ? currentShuffleIndex : currentPatternIndex);
 
-    Preferences prefs;
-    prefs.begin(Config::PREF_NAMESPACE, false);
-    if (prefs.putUChar(Config::PREF_PATTERN_KEY, currentPatternIndex) == 0) {
-        Serial.println(F("[ERROR] Failed to save pattern index"));
-    } else {
-        Serial.print(F("[DEBUG] Saved pattern index: ")); Serial.println(currentPatternIndex);
+    if (persistSettings) {
+        Preferences prefs;
+        prefs.begin(Config::PREF_NAMESPACE, false);
+        if (prefs.putUChar(Config::PREF_PATTERN_KEY, currentPatternIndex) == 0) {
+            Serial.println(F("[ERROR] Failed to save pattern index"));
+        } else {
+            Serial.print(F("[DEBUG] Saved pattern index: ")); Serial.println(currentPatternIndex);
+        }
+        prefs.end();
     }
-    prefs.end();
 
     Serial.print(F("Pattern set: ")); Serial.print(currentPatternIndex);
     Serial.print(F(" - ")); Serial.println(getCurrentAnimationName());
@@ -284,12 +375,14 @@ void AnimationManager::setNumLeds(uint16_t count) {
     if (currentPatternIndex < globalAnimationRegistry.size()) {
         createAnimation(inShuffleMode() ? currentShuffleIndex : currentPatternIndex);
     }
-    Preferences prefs;
-    prefs.begin(Config::PREF_NAMESPACE, false);
-    if (prefs.putUShort(Config::PREF_NUM_LEDS_KEY, numLeds) == 0) {
-        Serial.println(F("[ERROR] Failed to save numLeds"));
+    if (persistSettings) {
+        Preferences prefs;
+        prefs.begin(Config::PREF_NAMESPACE, false);
+        if (prefs.putUShort(Config::PREF_NUM_LEDS_KEY, numLeds) == 0) {
+            Serial.println(F("[ERROR] Failed to save numLeds"));
+        }
+        prefs.end();
     }
-    prefs.end();
     Serial.print(F("LED count set: ")); Serial.println(numLeds);
 }
 
@@ -303,12 +396,14 @@ void AnimationManager::setBrightness(uint8_t value) {
     if (currentAnimation) {
         currentAnimation->setBrightness(brightness);
     }
-    Preferences prefs;
-    prefs.begin(Config::PREF_NAMESPACE, false);
-    if (prefs.putUChar(Config::PREF_BRIGHTNESS_KEY, brightness) == 0) {
-        Serial.println(F("[ERROR] Failed to save brightness"));
+    if (persistSettings) {
+        Preferences prefs;
+        prefs.begin(Config::PREF_NAMESPACE, false);
+        if (prefs.putUChar(Config::PREF_BRIGHTNESS_KEY, brightness) == 0) {
+            Serial.println(F("[ERROR] Failed to save brightness"));
+        }
+        prefs.end();
     }
-    prefs.end();
 }
 
 void AnimationManager::createAnimation(uint8_t index) {
@@ -324,10 +419,19 @@ void AnimationManager::createAnimation(uint8_t index) {
     fill_solid(leds, MAX_LEDS, CRGB::Black);
 
     Serial.print(F("Creating: ")); Serial.println(globalAnimationRegistry[index].name);
-    currentAnimation = globalAnimationRegistry[index].createFn(leds, numLeds);
+    const uint16_t seed = seedBase + instanceCount++ * 40503u + index * 2053u;
+    currentAnimation = createSeeded(globalAnimationRegistry[index], leds, numLeds, seed);
     if (currentAnimation) {
         currentAnimation->setBrightness(brightness);
-        Serial.print(F("Animation created: ")); Serial.println(globalAnimationRegistry[index].name);
+        if (currentAnimation->getKeyframeInterval()) {
+            // Keyframed animations keep their own persistent frame; leds only shows the blend
+            fill_solid(keyframeNext, MAX_LEDS, CRGB::Black);
+            currentAnimation->setRenderBuffer(keyframeNext);
+            keyframeElapsed = 0;
+            keyframePrimed = false;
+        }
+        Serial.print(F("Animation created: ")); Serial.print(globalAnimationRegistry[index].name);
+        Serial.print(F(" (seed 0x")); Serial.print(seed, HEX); Serial.println(F(")"));
     } else {
         Serial.println(F("ERROR: Animation creation failed"));
     }
@@ -347,26 +451,26 @@ void AnimationManager::startShuffleTransition(uint8_t newIndex) {
         return;
     }
     if (currentAnimation) {
-        currentAnimation->update();
+        renderCurrentAnimation(ANIMATION_UPDATE_INTERVAL);
         memcpy(oldLedsBuffer, leds, sizeof(CRGB) * numLeds);
     }
     // Prepare tempLeds for transition
     createAnimation(newIndex);
     if (currentAnimation) {
-        currentAnimation->update();
+        renderCurrentAnimation(ANIMATION_UPDATE_INTERVAL);
         memcpy(tempLeds, leds, sizeof(CRGB) * numLeds);
     }
     inShuffleTransition = true;
-    shuffleTransitionStart = millis();
+    shuffleTransitionStart = frame.nowMs;
     shuffleTransitionNewIndex = newIndex;
     Serial.println(F("ShuffleTransition started"));
 }
 
 void AnimationManager::pickNewShuffle() {
-    lastShuffleTime = millis();
+    lastShuffleTime = frame.nowMs;
     switch (currentPatternIndex) {
     case 0:
-        currentShuffleDuration = random(5000, 30000); // random 5-30s
+        currentShuffleDuration = random16(5000, 30000); // random 5-30s
         break;
     case 1:
         currentShuffleDuration = 5000; // 5s
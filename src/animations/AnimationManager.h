@@ -25,8 +25,26 @@ public:
     uint8_t getCurrentPatternIndex();
     bool isReady() { return isInitialized; }
     void setCurrentPattern(uint8_t index);
+    // Deletes the running animation, e.g. for diagnostics that need the
+    // palette service to themselves; setCurrentPattern() brings one back
+    void releaseAnimation() { cleanupCurrentAnimation(); }
     void setNumLeds(uint16_t count);
     void setBrightness(uint8_t value);
+    void setTempo(uint8_t bpm) { tempo.setBpm(bpm); }
+    uint8_t getTempo() const { return tempo.getBpm(); }
+    // User hit for the current animation, seen as frame.onTrigger next frame
+    void trigger() { triggerPending = true; }
+
+    // Frame clock, millis() unless replaced (offline rendering, replays)
+    typedef unsigned long (*Clock)();
+    void setClock(Clock source);
+    // Seeds the random streams of the animations created from now on. The
+    // same seed, clock and inputs replay the same frames.
+    void setRandomSeed(uint16_t seed);
+    uint16_t getRandomSeed() const { return seedBase; }
+    // Pattern, LED count and brightness changes are saved to flash unless
+    // turned off (soak runs change them thousands of times)
+    void setPersistence(bool enabled) { persistSettings = enabled; }
 
     // Shuffle mode check
     bool inShuffleMode() const { return currentPatternIndex < 4; }
@@ -43,6 +61,13 @@ private:
     CRGB oldLedsBuffer[MAX_LEDS];
     CRGB tempLeds[MAX_LEDS];
 
+    // Keyframe mode: the animation renders into keyframeNext at a low rate and
+    // the output stage interpolates from keyframePrev towards it
+    CRGB keyframePrev[MAX_LEDS];
+    CRGB keyframeNext[MAX_LEDS];
+    uint32_t keyframeElapsed;
+    bool keyframePrimed;
+
     // Shuffle/transition fields
     bool inShuffleTransition;
     uint32_t shuffleTransitionStart;
@@ -50,6 +75,19 @@ private:
     uint8_t shuffleTransitionNewIndex;
     uint8_t currentShuffleIndex;
     unsigned long lastShuffleTime;
+    unsigned long lastFrameTime;
+
+    // Timing shared by every animation, advanced once per update()
+    FrameContext frame;
+    TempoClock tempo;
+    bool triggerPending;
+    Clock clock;
+
+    // Each animation gets its own random stream, seeded from seedBase and
+    // the number of animations created since
+    uint16_t seedBase;
+    uint16_t instanceCount;
+    bool persistSettings;
 
     void logFastLEDDiagnostics();
     void registerAnimations();
@@ -57,6 +95,8 @@ private:
     void cleanupCurrentAnimation();
     void startShuffleTransition(uint8_t newIndex);
     void pickNewShuffle();
+    void advanceFrame();
+    void renderCurrentAnimation(uint32_t deltaMs);
 };
 
 #endif // ANIMATION_MANAGER_H
\ No newline at end of file
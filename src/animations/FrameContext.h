@@ -0,0 +1,102 @@
+/**
+ * Frame Context
+ * Per-frame timing computed once by AnimationManager and handed to every
+ * Animation::update(). Use it instead of millis() and FastLED's beat
+ * functions so every pixel of a frame, and every animation, sees the same
+ * time and the same tempo.
+ */
+#ifndef FRAME_CONTEXT_H
+#define FRAME_CONTEXT_H
+
+#include <FastLED.h>
+#include "../config/Config.h"
+
+struct FrameContext {
+    uint32_t nowMs = 0;       // Frame timestamp
+    uint32_t deltaMs = 0;     // Time since the previous frame
+    uint32_t frameCount = 0;  // Frames rendered since boot
+
+    // Shared tempo clock (see TempoClock)
+    accum88 tempoBpm88 = DEFAULT_TEMPO_BPM << 8;
+    uint32_t beatCount = 0;   // Whole beats since boot
+    uint16_t beatPhase = 0;   // Position inside the current beat, 0-65535
+    uint16_t barPhase = 0;    // Position inside the current 4-beat bar
+    bool onBeat = false;      // A new beat started this frame
+    bool onBar = false;       // A new bar started this frame
+    bool onTrigger = false;   // The user triggered a hit (button double-click) since the last frame
+
+    // FastLED beat functions, evaluated at nowMs instead of millis().
+    // Same arguments and results as their FastLED namesakes.
+    uint16_t beat88(accum88 bpm88, uint32_t timebase = 0) const {
+        return ((nowMs - timebase) * bpm88 * 280) >> 16;
+    }
+    uint16_t beat16(accum88 bpm, uint32_t timebase = 0) const {
+        if (bpm < 256) bpm <<= 8;
+        return beat88(bpm, timebase);
+    }
+    uint8_t beat8(accum88 bpm, uint32_t timebase = 0) const {
+        return beat16(bpm, timebase) >> 8;
+    }
+    uint8_t beatsin8(accum88 bpm, uint8_t lowest = 0, uint8_t highest = 255,
+                     uint32_t timebase = 0, uint8_t phaseOffset = 0) const {
+        uint8_t beatsin = sin8(beat8(bpm, timebase) + phaseOffset);
+        return lowest + scale8(beatsin, highest - lowest);
+    }
+    uint16_t beatsin16(accum88 bpm, uint16_t lowest = 0, uint16_t highest = 65535,
+                       uint32_t timebase = 0, uint16_t phaseOffset = 0) const {
+        uint16_t beatsin = sin16(beat16(bpm, timebase) + phaseOffset) + 32768;
+        return lowest + scale16(beatsin, highest - lowest);
+    }
+    uint16_t beatsin88(accum88 bpm88, uint16_t lowest = 0, uint16_t highest = 65535,
+                       uint32_t timebase = 0, uint16_t phaseOffset = 0) const {
+        uint16_t beatsin = sin16(beat88(bpm88, timebase) + phaseOffset) + 32768;
+        return lowest + scale16(beatsin, highest - lowest);
+    }
+
+    // Phase of a cycle lasting `beats` beats of the shared tempo
+    uint16_t tempoPhase(uint8_t beats) const {
+        if (beats <= 1) return beatPhase;
+        return (uint16_t)((((beatCount % beats) << 16) + beatPhase) / beats);
+    }
+    // Sine locked to the shared tempo, one period every `beats` beats
+    uint8_t tempoSin8(uint8_t beats, uint8_t lowest = 0, uint8_t highest = 255) const {
+        return lowest + scale8(sin8(tempoPhase(beats) >> 8), highest - lowest);
+    }
+    uint16_t tempoSin16(uint8_t beats, uint16_t lowest = 0, uint16_t highest = 65535) const {
+        uint16_t beatsin = sin16(tempoPhase(beats)) + 32768;
+        return lowest + scale16(beatsin, highest - lowest);
+    }
+};
+
+// Accumulates beats from frame deltas so the phase stays continuous when the
+// tempo changes, and writes the result into a FrameContext.
+class TempoClock {
+public:
+    TempoClock() : bpm88(DEFAULT_TEMPO_BPM << 8), beatCount(0), remainder(0) {}
+
+    void setBpm(uint8_t bpm) { bpm88 = (accum88)bpm << 8; }
+    uint8_t getBpm() const { return bpm88 >> 8; }
+
+    void advance(FrameContext& frame) {
+        // One beat = 60000ms * 256 in units of ms * bpm88
+        static const uint32_t TICKS_PER_BEAT = 60000UL * 256;
+        const uint32_t lastBeat = beatCount;
+        uint64_t ticks = remainder + (uint64_t)frame.deltaMs * bpm88;
+        beatCount += ticks / TICKS_PER_BEAT;
+        remainder = ticks % TICKS_PER_BEAT;
+
+        frame.tempoBpm88 = bpm88;
+        frame.beatCount = beatCount;
+        frame.beatPhase = ((uint64_t)remainder << 16) / TICKS_PER_BEAT;
+        frame.barPhase = (uint16_t)((((beatCount & 3) << 16) + frame.beatPhase) >> 2);
+        frame.onBeat = beatCount != lastBeat;
+        frame.onBar = frame.onBeat && (beatCount >> 2) != (lastBeat >> 2);
+    }
+
+private:
+    accum88 bpm88;
+    uint32_t beatCount;
+    uint32_t remainder;
+};
+
+#endif // FRAME_CONTEXT_H
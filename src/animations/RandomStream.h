@@ -0,0 +1,57 @@
+/**
+ * Random Stream
+ * Per-animation random numbers. FastLED's random8()/random16() step one
+ * shared 16-bit generator; every animation keeps its own copy of that state
+ * and a Scope swaps it in while the animation is constructed and updated.
+ * Every random8()/random16() call made on its behalf, in the themes, the
+ * effects or the render helpers, then draws from the animation's own
+ * sequence. Given the seed and the frame times, the frames come out the same
+ * whatever else is running.
+ */
+#ifndef RANDOM_STREAM_H
+#define RANDOM_STREAM_H
+
+#include <FastLED.h>
+
+class RandomStream {
+public:
+    explicit RandomStream(uint16_t seed = 0) : seed(seed) {}
+
+    void setState(uint16_t value) { seed = value; }
+    uint16_t state() const { return seed; }
+
+    // Makes the stream FastLED's random source until the end of the scope,
+    // then keeps the advanced state and puts the previous source back
+    class Scope {
+    public:
+        explicit Scope(RandomStream& stream) : stream(stream), saved(random16_get_seed()) {
+            random16_set_seed(stream.seed);
+        }
+        ~Scope() {
+            stream.seed = random16_get_seed();
+            random16_set_seed(saved);
+        }
+
+    private:
+        RandomStream& stream;
+        uint16_t saved;
+    };
+
+    // count random bytes from the current source, one per generator step
+    // with the state held in a register; the same bytes as calling random8()
+    // count times. Like random8(), each byte adds the two halves of the
+    // state: the low byte alone repeats every 256 steps. For per-pixel dice.
+    static void fill(uint8_t* out, uint16_t count) {
+        uint16_t s = random16_get_seed();
+        for (uint16_t i = 0; i < count; i++) {
+            s = APPLY_FASTLED_RAND16_2053(s) + FASTLED_RAND16_13849;
+            out[i] = (uint8_t)((s & 0xFF) + (s >> 8));
+        }
+        random16_set_seed(s);
+    }
+
+private:
+    uint16_t seed;
+};
+
+#endif // RANDOM_STREAM_H
@@ -0,0 +1,51 @@
+/**
+ * Time-based motion helpers
+ * Turn the elapsed frame time handed to Animation::update() into motion that
+ * looks the same at any frame rate.
+ */
+#ifndef TIME_MOTION_H
+#define TIME_MOTION_H
+
+#include <stdint.h>
+#include "../config/Config.h"
+
+// Frame period the per-frame constants in the themes were tuned at
+#define NOMINAL_FRAME_MS ANIMATION_UPDATE_INTERVAL
+
+// Converts a rate ("units per periodMs") into whole units for the time that
+// actually elapsed. The remainder is carried over, so slow rates never stall
+// and fast frames never run ahead. Use one accumulator per rate.
+class RateAccumulator {
+public:
+    RateAccumulator() : accum(0) {}
+
+    // e.g. advance(deltaMs, 1, 20) replaces EVERY_N_MILLISECONDS(20) { x++; }
+    uint32_t advance(uint32_t deltaMs, uint32_t units, uint32_t periodMs) {
+        accum += deltaMs * units;
+        uint32_t steps = accum / periodMs;
+        accum -= steps * periodMs;
+        return steps;
+    }
+
+    // e.g. perFrame(deltaMs, 3) replaces a plain `x += 3` in update()
+    uint32_t perFrame(uint32_t deltaMs, uint32_t unitsPerFrame) {
+        return advance(deltaMs, unitsPerFrame, NOMINAL_FRAME_MS);
+    }
+
+    void reset() { accum = 0; }
+
+private:
+    uint32_t accum;
+};
+
+// Number of nominal frames that fit in deltaMs, for float state
+inline float framesElapsed(uint32_t deltaMs) {
+    return (float)deltaMs / NOMINAL_FRAME_MS;
+}
+
+// Same in Q8 (256 = one nominal frame), for fixed-point state
+inline uint32_t framesElapsedQ8(uint32_t deltaMs) {
+    return (deltaMs << 8) / NOMINAL_FRAME_MS;
+}
+
+#endif // TIME_MOTION_H
@@ -0,0 +1,141 @@
+/**
+ * Timer Wheel
+ * Per-animation scheduler for "every so often" events: mood swaps, palette
+ * retargets, thunderclaps. Use it instead of polling millis() against a
+ * member or a static, and instead of EVERY_N_* inside class methods, whose
+ * hidden statics are shared by every instance of the class.
+ *
+ * The wheel runs on its own clock, built from frame.deltaMs and starting at
+ * zero, so a recreated animation starts its timers over. Handlers are member
+ * functions of the owning animation, called from tick():
+ *
+ *   TimerWheel<MyAnimation> timers;
+ *   MyAnimation(...) { timers.every(15000, &MyAnimation::switchPhase); }
+ *   void update(const FrameContext& frame) override { timers.tick(*this, frame); ... }
+ *
+ * The earliest due time is cached, so a frame with nothing due costs one
+ * add and one compare. Slots are a small fixed array; an animation has a
+ * handful of timers at most, which doesn't justify hashed buckets.
+ */
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <FastLED.h>
+#include "FrameContext.h"
+
+template <typename Owner, uint8_t SLOTS = 4>
+class TimerWheel {
+public:
+    typedef void (Owner::*Handler)(const FrameContext& frame);
+
+    TimerWheel() : clock(0), nextDue(0), armed(false) {
+        for (uint8_t s = 0; s < SLOTS; s++) slots[s].handler = nullptr;
+    }
+
+    // Schedulers return the timer id, or -1 when every slot is taken.
+    // Runs handler once, delayMs from now
+    int8_t after(uint32_t delayMs, Handler handler) {
+        return schedule(handler, delayMs, 0, 0);
+    }
+    // Runs handler every periodMs, first time periodMs from now
+    int8_t every(uint32_t periodMs, Handler handler) {
+        return schedule(handler, periodMs, periodMs, periodMs);
+    }
+    // Runs handler repeatedly, each gap drawn afresh from minMs to maxMs
+    int8_t everyRandom(uint32_t minMs, uint32_t maxMs, Handler handler) {
+        return schedule(handler, draw(minMs, maxMs), minMs, maxMs);
+    }
+
+    void cancel(int8_t id) {
+        if (id < 0 || id >= SLOTS) return;
+        slots[id].handler = nullptr;
+        refresh();
+    }
+    // Moves a pending timer's next run to delayMs from now
+    void restart(int8_t id, uint32_t delayMs) {
+        if (id < 0 || id >= SLOTS || !slots[id].handler) return;
+        slots[id].due = clock + delayMs;
+        refresh();
+    }
+    bool pending(int8_t id) const {
+        return id >= 0 && id < SLOTS && slots[id].handler;
+    }
+
+    // Advances the clock and runs the handlers that came due. A repeating
+    // timer runs at most once per tick; after a long stall it picks up
+    // from now instead of firing a burst.
+    void tick(Owner& owner, const FrameContext& frame) {
+        clock += frame.deltaMs;
+        if (!armed || (int32_t)(clock - nextDue) < 0) return;
+        for (uint8_t s = 0; s < SLOTS; s++) {
+            Slot& slot = slots[s];
+            if (!slot.handler || (int32_t)(clock - slot.due) < 0) continue;
+            const Handler handler = slot.handler;
+            // Rescheduled before the call, so the handler may cancel or
+            // restart its own timer
+            if (slot.maxPeriod == 0) {
+                slot.handler = nullptr;
+            } else {
+                slot.due += draw(slot.minPeriod, slot.maxPeriod);
+                if ((int32_t)(clock - slot.due) >= 0) slot.due = clock + slot.minPeriod;
+            }
+            (owner.*handler)(frame);
+        }
+        refresh();
+    }
+
+    // EVERY_N_MILLISECONDS for code that only runs on some frames: true at
+    // most once per periodMs of this wheel's clock. lastMs belongs to the
+    // caller and starts at 0.
+    bool throttle(uint32_t& lastMs, uint32_t periodMs) const {
+        if (clock - lastMs < periodMs) return false;
+        lastMs = clock;
+        return true;
+    }
+
+    // Time since the wheel was created
+    uint32_t now() const { return clock; }
+
+private:
+    struct Slot {
+        Handler handler;     // nullptr when free
+        uint32_t due;
+        uint32_t minPeriod;
+        uint32_t maxPeriod;  // 0 for one-shot timers
+    };
+
+    int8_t schedule(Handler handler, uint32_t delayMs, uint32_t minPeriod, uint32_t maxPeriod) {
+        for (uint8_t s = 0; s < SLOTS; s++) {
+            if (slots[s].handler) continue;
+            slots[s].handler = handler;
+            slots[s].due = clock + delayMs;
+            slots[s].minPeriod = minPeriod;
+            slots[s].maxPeriod = maxPeriod;
+            refresh();
+            return s;
+        }
+        return -1;
+    }
+
+    static uint32_t draw(uint32_t minMs, uint32_t maxMs) {
+        if (maxMs <= minMs) return minMs;
+        return minMs + (uint32_t)(((uint64_t)random16() * (maxMs - minMs + 1)) >> 16);
+    }
+
+    // Re-caches the earliest due time
+    void refresh() {
+        armed = false;
+        for (uint8_t s = 0; s < SLOTS; s++) {
+            if (!slots[s].handler) continue;
+            if (!armed || (int32_t)(slots[s].due - nextDue) < 0) nextDue = slots[s].due;
+            armed = true;
+        }
+    }
+
+    Slot slots[SLOTS];
+    uint32_t clock;
+    uint32_t nextDue;
+    bool armed;
+};
+
+#endif // TIMER_WHEEL_H
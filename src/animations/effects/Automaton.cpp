@@ -0,0 +1,192 @@
+/**
+ * Cellular Automata Implementation
+ *
+ * Cell i lives in bit (i & 31) of word (i >> 5). For word w, the word of
+ * left neighbours is the row shifted up one bit with the carry from the
+ * word below, and the right neighbours are shifted down with the carry
+ * from the word above; the first and last words wrap to each other.
+ */
+#include "Automaton.h"
+#include <algorithm>
+#include "../render/PaletteGather.h"
+
+namespace {
+
+uint16_t wordsFor(uint16_t cells) { return (cells + 31) >> 5; }
+
+// Valid bits of the last word
+uint32_t lastWordMask(uint16_t cells) {
+    const uint8_t used = cells & 31;
+    return used ? (1UL << used) - 1 : 0xFFFFFFFFUL;
+}
+
+// Bit k holds the left neighbour of cell 32w + k
+inline uint32_t leftOf(const uint32_t* row, uint16_t w, uint16_t words, uint8_t lastBit) {
+    const uint32_t carry = w > 0 ? row[w - 1] >> 31 : row[words - 1] >> lastBit & 1;
+    return row[w] << 1 | carry;
+}
+
+// Bit k holds the right neighbour of cell 32w + k
+inline uint32_t rightOf(const uint32_t* row, uint16_t w, uint16_t words, uint8_t lastBit) {
+    if (w + 1 < words) return row[w] >> 1 | row[w + 1] << 31;
+    return row[w] >> 1 | (row[0] & 1) << lastBit;
+}
+
+uint32_t randomWord() {
+    return (uint32_t)random16() << 16 | random16();
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// ElementaryAutomaton
+
+ElementaryAutomaton::ElementaryAutomaton() : numCells(0), rule(30), trailFade(24), rate(60) {}
+
+void ElementaryAutomaton::configure(uint16_t cells) {
+    if (cells == numCells) return;
+    numCells = cells;
+    row.assign(wordsFor(cells), 0);
+    scratch.assign(row.size(), 0);
+    trail.assign(cells, 0);
+    shade.assign(cells, 0);
+}
+
+void ElementaryAutomaton::seedSingle(uint16_t cell) {
+    std::fill(row.begin(), row.end(), 0);
+    if (cell < numCells) row[cell >> 5] |= 1UL << (cell & 31);
+}
+
+void ElementaryAutomaton::seedRandom(uint8_t density) {
+    if (row.empty()) return;
+    for (uint32_t& word : row) {
+        word = 0;
+        for (uint8_t b = 0; b < 32; b++) {
+            if (random8() < density) word |= 1UL << b;
+        }
+    }
+    row.back() &= lastWordMask(numCells);
+}
+
+void ElementaryAutomaton::step() {
+    const uint16_t words = row.size();
+    if (words == 0) return;
+    const uint8_t lastBit = (numCells - 1) & 31;
+    const uint32_t* cur = row.data();
+    for (uint16_t w = 0; w < words; w++) {
+        const uint32_t l = leftOf(cur, w, words, lastBit);
+        const uint32_t c = cur[w];
+        const uint32_t r = rightOf(cur, w, words, lastBit);
+        // Sum of the rule's minterms: neighbourhood value l*4 + c*2 + r
+        uint32_t out = 0;
+        for (uint8_t p = 0; p < 8; p++) {
+            if (!(rule >> p & 1)) continue;
+            out |= (p & 4 ? l : ~l) & (p & 2 ? c : ~c) & (p & 1 ? r : ~r);
+        }
+        scratch[w] = out;
+    }
+    scratch.back() &= lastWordMask(numCells);
+    row.swap(scratch);
+}
+
+void ElementaryAutomaton::update(uint32_t deltaMs) {
+    uint32_t steps = stepTimer.advance(deltaMs, rate, 1000);
+    if (steps > MAX_STEPS_PER_FRAME) steps = MAX_STEPS_PER_FRAME;
+    while (steps--) step();
+
+    // Trails once per frame: live cells full, the rest fading
+    const uint32_t fade = fadeTimer.perFrame(deltaMs, trailFade);
+    const uint8_t amount = fade > 255 ? 255 : fade;
+    for (uint16_t i = 0; i < numCells; i++) {
+        trail[i] = alive(i) ? 255 : qsub8(trail[i], amount);
+    }
+}
+
+void ElementaryAutomaton::render(CRGB* leds, const CRGBPalette16& palette, uint8_t indexOffset, uint8_t brightness) {
+    uint8_t* index = Render::gatherScratch();
+    for (uint16_t i = 0; i < numCells; i++) {
+        index[i] = (255 - trail[i]) >> 1; // Older trail, further along the palette
+        shade[i] = scale8(trail[i], brightness);
+    }
+    Render::gatherPalette(leds, palette, index, indexOffset, shade.data(), numCells);
+}
+
+uint16_t ElementaryAutomaton::population() const {
+    uint16_t count = 0;
+    for (uint32_t word : row) count += __builtin_popcount(word);
+    return count;
+}
+
+// ---------------------------------------------------------------------------
+// CyclicAutomaton
+
+CyclicAutomaton::CyclicAutomaton() : numCells(0), planeCount(0), rate(30), changed(0) {}
+
+void CyclicAutomaton::configure(uint16_t cells, uint8_t stateBits) {
+    numCells = cells;
+    planeCount = stateBits < 1 ? 1 : (stateBits > MAX_PLANES ? MAX_PLANES : stateBits);
+    for (uint8_t p = 0; p < MAX_PLANES; p++) {
+        planes[p].assign(p < planeCount ? wordsFor(cells) : 0, 0);
+        next[p].assign(planes[p].size(), 0);
+    }
+}
+
+void CyclicAutomaton::seedRandom() {
+    for (uint8_t p = 0; p < planeCount; p++) {
+        for (uint32_t& word : planes[p]) word = randomWord();
+        if (!planes[p].empty()) planes[p].back() &= lastWordMask(numCells);
+    }
+}
+
+uint16_t CyclicAutomaton::step() {
+    const uint16_t words = planes[0].size();
+    if (words == 0) return 0;
+    const uint8_t lastBit = (numCells - 1) & 31;
+    uint16_t changedCells = 0;
+    for (uint16_t w = 0; w < words; w++) {
+        // Bit-sliced increment: succ = state + 1 mod 2^planeCount
+        uint32_t succ[MAX_PLANES];
+        uint32_t carry = 0xFFFFFFFFUL;
+        for (uint8_t p = 0; p < planeCount; p++) {
+            const uint32_t s = planes[p][w];
+            succ[p] = s ^ carry;
+            carry &= s;
+        }
+        // Cells whose left or right neighbour already holds succ
+        uint32_t matchLeft = 0xFFFFFFFFUL, matchRight = 0xFFFFFFFFUL;
+        for (uint8_t p = 0; p < planeCount; p++) {
+            matchLeft &= ~(leftOf(planes[p].data(), w, words, lastBit) ^ succ[p]);
+            matchRight &= ~(rightOf(planes[p].data(), w, words, lastBit) ^ succ[p]);
+        }
+        uint32_t advance = matchLeft | matchRight;
+        if (w + 1 == words) advance &= lastWordMask(numCells);
+        for (uint8_t p = 0; p < planeCount; p++) {
+            next[p][w] = (succ[p] & advance) | (planes[p][w] & ~advance);
+        }
+        changedCells += __builtin_popcount(advance);
+    }
+    for (uint8_t p = 0; p < planeCount; p++) planes[p].swap(next[p]);
+    return changedCells;
+}
+
+void CyclicAutomaton::update(uint32_t deltaMs) {
+    uint32_t steps = stepTimer.advance(deltaMs, rate, 1000);
+    if (steps > ElementaryAutomaton::MAX_STEPS_PER_FRAME) steps = ElementaryAutomaton::MAX_STEPS_PER_FRAME;
+    changed = 0;
+    while (steps--) changed += step();
+}
+
+uint8_t CyclicAutomaton::state(uint16_t cell) const {
+    uint8_t s = 0;
+    for (uint8_t p = 0; p < planeCount; p++) {
+        s |= (planes[p][cell >> 5] >> (cell & 31) & 1) << p;
+    }
+    return s;
+}
+
+void CyclicAutomaton::render(CRGB* leds, const CRGBPalette16& palette, uint8_t indexOffset, uint8_t brightness) const {
+    uint8_t* index = Render::gatherScratch();
+    const uint8_t shift = 8 - planeCount; // States spread over the whole palette
+    for (uint16_t i = 0; i < numCells; i++) index[i] = state(i) << shift;
+    Render::gatherPalette(leds, palette, index, indexOffset, brightness, numCells);
+}
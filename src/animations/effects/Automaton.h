@@ -0,0 +1,101 @@
+/**
+ * Cellular Automata
+ * 1D automata on bit-packed rows: 32 cells per 32-bit word, evolved with
+ * word-wide logic, so one generation over 1000 cells is about 32 loop
+ * iterations. Rows wrap around into a ring.
+ *
+ * ElementaryAutomaton runs any of Wolfram's 256 two-state rules (30, 90,
+ * 110, ...). Live cells leave a fading trail, kept per cell and updated
+ * once per frame rather than per generation; render() maps the trail
+ * through a palette.
+ *
+ * CyclicAutomaton has 2, 4, 8 or 16 states held in bit planes. A cell
+ * moves to the next state when a neighbour is already there, which grows
+ * travelling waves out of random noise.
+ */
+#ifndef AUTOMATON_H
+#define AUTOMATON_H
+
+#include <FastLED.h>
+#include <vector>
+#include "../TimeMotion.h"
+
+class ElementaryAutomaton {
+public:
+    ElementaryAutomaton();
+
+    // Sizes the row; clears it when the size changes
+    void configure(uint16_t cells);
+    void setRule(uint8_t value) { rule = value; }
+    uint8_t getRule() const { return rule; }
+    // Generations per second and the trail fade per nominal frame
+    void setRate(uint16_t generationsPerSecond) { rate = generationsPerSecond; }
+    void setTrailFade(uint8_t fadePerFrame) { trailFade = fadePerFrame; }
+
+    void seedSingle(uint16_t cell);
+    void seedRandom(uint8_t density = 128);
+
+    // Runs the generations due (at most MAX_STEPS_PER_FRAME), then trails
+    void update(uint32_t deltaMs);
+    void step();
+
+    // Trail brightness through the palette, fresh cells at indexOffset and
+    // older ones further along it
+    void render(CRGB* leds, const CRGBPalette16& palette, uint8_t indexOffset, uint8_t brightness = 255);
+
+    bool alive(uint16_t cell) const { return row[cell >> 5] >> (cell & 31) & 1; }
+    uint16_t population() const;
+    uint16_t size() const { return numCells; }
+
+    static const uint8_t MAX_STEPS_PER_FRAME = 8;
+
+private:
+    std::vector<uint32_t> row;
+    std::vector<uint32_t> scratch;
+    std::vector<uint8_t> trail;
+    std::vector<uint8_t> shade;
+    uint16_t numCells;
+    uint8_t rule;
+    uint8_t trailFade;
+    uint16_t rate;
+    RateAccumulator stepTimer;
+    RateAccumulator fadeTimer;
+};
+
+class CyclicAutomaton {
+public:
+    static const uint8_t MAX_PLANES = 4;
+
+    CyclicAutomaton();
+
+    // stateBits 1-4 gives 2-16 states; clears the row
+    void configure(uint16_t cells, uint8_t stateBits);
+    void setRate(uint16_t generationsPerSecond) { rate = generationsPerSecond; }
+
+    void seedRandom();
+
+    // Runs the generations due, at most ElementaryAutomaton::MAX_STEPS_PER_FRAME
+    void update(uint32_t deltaMs);
+    // Returns how many cells changed
+    uint16_t step();
+
+    // State through the palette, spread evenly from indexOffset
+    void render(CRGB* leds, const CRGBPalette16& palette, uint8_t indexOffset, uint8_t brightness = 255) const;
+
+    uint8_t state(uint16_t cell) const;
+    uint8_t states() const { return 1 << planeCount; }
+    uint16_t size() const { return numCells; }
+    // Cells changed over the last update()
+    uint16_t activity() const { return changed; }
+
+private:
+    std::vector<uint32_t> planes[MAX_PLANES];
+    std::vector<uint32_t> next[MAX_PLANES];
+    uint16_t numCells;
+    uint8_t planeCount;
+    uint16_t rate;
+    uint16_t changed;
+    RateAccumulator stepTimer;
+};
+
+#endif // AUTOMATON_H
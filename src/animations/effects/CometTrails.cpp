@@ -0,0 +1,91 @@
+/**
+ * Comet Trails Implementation
+ */
+#include "CometTrails.h"
+
+CometTrails::CometTrails()
+    : cometCount(0), numPixels(0), width(256), fadePeriod(NOMINAL_FRAME_MS), nowMs(0), dirty(0), lastBuffer(nullptr) {}
+
+void CometTrails::configure(uint16_t pixels, uint8_t fadeAmount, uint16_t fadePeriodMs) {
+    numPixels = pixels;
+    fadePeriod = fadePeriodMs ? fadePeriodMs : 1;
+    history.assign((size_t)MAX_COMETS * HISTORY, Sample{0, 0, CRGB::Black});
+
+    // Level left after k fades, cut off once it is too dim to show
+    decay.clear();
+    uint8_t level = 255;
+    while (level >= 2 && decay.size() < 255) {
+        decay.push_back(level);
+        level = scale8(level, 255 - fadeAmount);
+    }
+    clear();
+}
+
+void CometTrails::clear() {
+    cometCount = 0;
+    lastBuffer = nullptr;
+}
+
+void CometTrails::moveTo(uint8_t i, int32_t pos, const CRGB& color) {
+    if (i >= MAX_COMETS || history.empty()) return;
+    while (cometCount <= i) comets[cometCount++] = Comet{0, 0, 0, 0};
+    Comet& c = comets[i];
+    c.head = (c.head + 1) % HISTORY;
+    if (c.length < HISTORY) c.length++;
+    history[i * HISTORY + c.head] = Sample{pos, nowMs, color};
+}
+
+void CometTrails::render(CRGB* leds) {
+    dirty = 0;
+    if (leds != lastBuffer) {
+        fill_solid(leds, numPixels, CRGB::Black);
+        lastBuffer = leds;
+        dirty = numPixels;
+    } else {
+        for (uint8_t i = 0; i < cometCount; i++) {
+            const Comet& c = comets[i];
+            fill_solid(leds + c.spanLo, c.spanHi - c.spanLo, CRGB::Black);
+            dirty += c.spanHi - c.spanLo;
+        }
+    }
+
+    for (uint8_t i = 0; i < cometCount; i++) {
+        Comet& c = comets[i];
+        // Drop samples that have faded out
+        while (c.length > 0 && (nowMs - sample(i, c.length - 1).timeMs) / fadePeriod >= decay.size()) {
+            c.length--;
+        }
+        c.spanLo = numPixels;
+        c.spanHi = 0;
+        for (uint8_t age = 0; age < c.length; age++) {
+            const Sample& newer = sample(i, age);
+            const Sample& older = age + 1 < c.length ? sample(i, age + 1) : newer;
+            const uint8_t level = decay[(nowMs - newer.timeMs) / fadePeriod];
+            drawSegment(leds, newer.pos, older.pos, newer.color, level, c);
+        }
+        if (c.spanLo >= c.spanHi) c.spanLo = c.spanHi = 0;
+        dirty += c.spanHi - c.spanLo;
+    }
+}
+
+void CometTrails::drawSegment(CRGB* leds, int32_t a, int32_t b, const CRGB& color, uint8_t level, Comet& c) {
+    // Covered interval in Q16, shifted so pixel i spans [i, i + 1)
+    const int32_t half = (int32_t)width << 7;
+    const int32_t lo = (a < b ? a : b) - half + 0x8000;
+    const int32_t hi = (a < b ? b : a) + half + 0x8000;
+    if (hi <= 0 || lo >= ((int32_t)numPixels << 16)) return;
+
+    const uint16_t first = lo > 0 ? lo >> 16 : 0;
+    const uint16_t last = ((hi - 1) >> 16) < numPixels ? (hi - 1) >> 16 : numPixels - 1;
+    for (uint16_t p = first; p <= last; p++) {
+        const int32_t pixelLo = (int32_t)p << 16;
+        const int32_t coverage = ((hi < pixelLo + 0x10000 ? hi : pixelLo + 0x10000) - (lo > pixelLo ? lo : pixelLo)) >> 8;
+        const uint8_t amount = coverage >= 256 ? level : (uint8_t)((level * coverage) >> 8);
+        if (amount == 0) continue;
+        CRGB shade = color;
+        if (amount < 255) shade.nscale8(amount);
+        leds[p] |= shade;
+    }
+    if (first < c.spanLo) c.spanLo = first;
+    if (last + 1 > c.spanHi) c.spanHi = last + 1;
+}
@@ -0,0 +1,87 @@
+/**
+ * Comet Trails
+ * Anti-aliased moving dots with fading trails, drawn without touching the
+ * rest of the strip. Each comet remembers where its head has been over the
+ * last few hundred milliseconds; render() clears the span it drew last
+ * frame and redraws the trail from that history, dimmed by age the way a
+ * per-frame fadeToBlackBy() would dim it. Cost follows the number and
+ * speed of comets, not the strip length.
+ *
+ * Positions are Q16 pixels (16-bit fraction), with pixel i centred on i.
+ * Segments between consecutive head positions are drawn with box coverage,
+ * so fast comets leave a continuous line instead of separated dots.
+ * Overlapping trails combine with a per-channel max, like `|=`.
+ */
+#ifndef COMET_TRAILS_H
+#define COMET_TRAILS_H
+
+#include <FastLED.h>
+#include <vector>
+#include "../TimeMotion.h"
+
+class CometTrails {
+public:
+    static const uint8_t MAX_COMETS = 8;
+    static const uint8_t HISTORY = 64; // Head positions kept per comet
+
+    CometTrails();
+
+    // Trails fade as if fadeToBlackBy(leds, n, fadeAmount) ran every fadePeriodMs
+    void configure(uint16_t numLeds, uint8_t fadeAmount, uint16_t fadePeriodMs = NOMINAL_FRAME_MS);
+    // Head width in Q8 pixels (256 = one pixel)
+    void setWidth(uint16_t widthQ8) { width = widthQ8; }
+
+    // Call once per frame before moving the comets
+    void advance(uint32_t deltaMs) { nowMs += deltaMs; }
+
+    // Places comet `i`'s head; its trail keeps the colours it was drawn with
+    void moveTo(uint8_t i, int32_t pos, const CRGB& color);
+
+    // Redraws every comet into leds[0, numLeds). A different buffer than last
+    // time is cleared in full first, since its contents are unknown.
+    void render(CRGB* leds);
+
+    // Forgets all trails; the next render() clears the whole buffer
+    void clear();
+
+    // Pixels cleared and drawn by the last render()
+    uint16_t dirtyPixels() const { return dirty; }
+
+    // Maps a 16-bit phase such as beatsin16()'s full range onto [0, numLeds - 1]
+    static int32_t sweep(uint16_t phase, uint16_t numLeds) {
+        const uint32_t scaled = (uint32_t)(numLeds - 1) * phase;
+        return (int32_t)(scaled + (scaled >> 16));
+    }
+
+private:
+    struct Sample {
+        int32_t pos;
+        uint32_t timeMs;
+        CRGB color;
+    };
+
+    struct Comet {
+        uint8_t head;   // Ring index of the newest sample
+        uint8_t length; // Samples in the ring
+        uint16_t spanLo;
+        uint16_t spanHi; // Exclusive; spanLo == spanHi when nothing drawn
+    };
+
+    const Sample& sample(uint8_t comet, uint8_t age) const {
+        return history[comet * HISTORY + (uint8_t)(comets[comet].head + HISTORY - age) % HISTORY];
+    }
+    void drawSegment(CRGB* leds, int32_t a, int32_t b, const CRGB& color, uint8_t level, Comet& c);
+
+    std::vector<Sample> history;
+    std::vector<uint8_t> decay; // Trail level by age in fade periods
+    Comet comets[MAX_COMETS];
+    uint8_t cometCount;
+    uint16_t numPixels;
+    uint16_t width;
+    uint16_t fadePeriod;
+    uint32_t nowMs;
+    uint16_t dirty;
+    CRGB* lastBuffer;
+};
+
+#endif // COMET_TRAILS_H
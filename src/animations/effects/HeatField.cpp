@@ -0,0 +1,71 @@
+/**
+ * Heat Field Implementation
+ */
+#include "HeatField.h"
+#include "../render/PaletteGather.h"
+
+HeatField::HeatField()
+    : numPixels(0), sourceCount(0), cooling(55), sparking(120), sparkMin(160), sparkMax(255) {}
+
+void HeatField::configure(uint16_t pixels) {
+    if (pixels == numPixels) return;
+    numPixels = pixels;
+    heat.assign(numPixels, 0);
+    sourceCount = 0;
+}
+
+bool HeatField::addSource(uint16_t origin, uint16_t length, bool reverse) {
+    if (sourceCount >= MAX_SOURCES || origin >= numPixels || length == 0) return false;
+    // Clip the segment to the strip
+    const uint16_t room = reverse ? origin + 1 : numPixels - origin;
+    sources[sourceCount++] = {origin, length < room ? length : room, reverse};
+    return true;
+}
+
+void HeatField::update(uint32_t deltaMs) {
+    if (stepTimer.perFrame(deltaMs, 1) > 0) step();
+}
+
+void HeatField::step() {
+    for (uint8_t s = 0; s < sourceCount; s++) {
+        const Source& src = sources[s];
+        const uint16_t len = src.length;
+
+        // 1. Cool every cell a little; the range shrinks with flame length
+        const uint16_t coolRange = (uint16_t)cooling * 10 / len + 2;
+        const uint8_t coolMax = coolRange > 255 ? 255 : coolRange;
+        for (uint16_t k = 0; k < len; k += 2) {
+            const uint16_t r = random16(); // Two random bytes per call
+            uint8_t& a = cell(src, k);
+            a = qsub8(a, scale8(r >> 8, coolMax));
+            if (k + 1 < len) {
+                uint8_t& b = cell(src, k + 1);
+                b = qsub8(b, scale8(r & 0xFF, coolMax));
+            }
+        }
+
+        // 2. Heat drifts away from the source and diffuses a little
+        for (uint16_t k = len - 1; k >= 2; k--) {
+            cell(src, k) = ((uint16_t)cell(src, k - 1) + 2 * cell(src, k - 2)) * 171 >> 9; // ~/3
+        }
+
+        // 3. Randomly ignite new sparks near the source
+        if (random8() < sparking) {
+            const uint8_t y = random8(len < 7 ? len : 7);
+            uint8_t& c = cell(src, y);
+            c = qadd8(c, random8(sparkMin, sparkMax));
+        }
+    }
+}
+
+void HeatField::render(CRGB* leds, const CRGBPalette16& palette, uint8_t indexOffset, bool heatAsBrightness) const {
+    uint8_t* index = Render::gatherScratch();
+    for (uint16_t i = 0; i < numPixels; i++) {
+        index[i] = scale8(heat[i], 240); // Keeps the hottest cells off the wrap back to entry 0
+    }
+    if (heatAsBrightness) {
+        Render::gatherPalette(leds, palette, index, indexOffset, heat.data(), numPixels);
+    } else {
+        Render::gatherPalette(leds, palette, index, indexOffset, (uint8_t)255, numPixels);
+    }
+}
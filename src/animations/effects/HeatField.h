@@ -0,0 +1,74 @@
+/**
+ * Heat Field
+ * Byte-per-pixel fire simulation in the style of FastLED's Fire2012:
+ * every step cools each cell a little, drifts heat away from the flame
+ * sources and sparks new heat near them; render() maps heat through a
+ * palette. Everything is integer math over one buffer of numPixels bytes.
+ *
+ * Each source owns a segment of the strip and burns along it in one
+ * direction, so a source at each end pointing inward gives mirrored
+ * flames and two sources at one origin burn both ways.
+ */
+#ifndef HEAT_FIELD_H
+#define HEAT_FIELD_H
+
+#include <FastLED.h>
+#include <vector>
+#include "../TimeMotion.h"
+
+class HeatField {
+public:
+    static const uint8_t MAX_SOURCES = 4;
+
+    HeatField();
+
+    // Sizes the heat buffer; clears heat and sources when the size changes
+    void configure(uint16_t numPixels);
+
+    // Flame rising from `origin` over `length` pixels toward higher indices,
+    // or toward lower ones when `reverse`. Returns false when full.
+    bool addSource(uint16_t origin, uint16_t length, bool reverse = false);
+    void clearSources() { sourceCount = 0; }
+
+    // Fire2012 parameters: cooling 20-100 (higher = shorter flames),
+    // sparking 50-200 (chance per step of a new spark at each source)
+    void setCooling(uint8_t value) { cooling = value; }
+    void setSparking(uint8_t value) { sparking = value; }
+    void setSparkHeat(uint8_t minHeat, uint8_t maxHeat) { sparkMin = minHeat; sparkMax = maxHeat; }
+
+    // Steps the simulation at the nominal frame rate. A late frame still
+    // gets a single step, so the cost per frame stays fixed.
+    void update(uint32_t deltaMs);
+    void step();
+
+    // Heat through the palette as Fire2012WithPalette does (0-240 of the
+    // palette). heatAsBrightness also dims cold cells, for palettes that
+    // don't start at black.
+    void render(CRGB* leds, const CRGBPalette16& palette, uint8_t indexOffset = 0, bool heatAsBrightness = false) const;
+
+    uint8_t operator[](uint16_t i) const { return heat[i]; }
+    const uint8_t* data() const { return heat.data(); }
+    uint16_t size() const { return numPixels; }
+
+private:
+    struct Source {
+        uint16_t origin;
+        uint16_t length;
+        bool reverse;
+    };
+
+    // Heat cell k steps along the source's direction
+    uint8_t& cell(const Source& s, uint16_t k) { return heat[s.reverse ? s.origin - k : s.origin + k]; }
+
+    std::vector<uint8_t> heat;
+    uint16_t numPixels;
+    Source sources[MAX_SOURCES];
+    uint8_t sourceCount;
+    uint8_t cooling;
+    uint8_t sparking;
+    uint8_t sparkMin;
+    uint8_t sparkMax;
+    RateAccumulator stepTimer;
+};
+
+#endif // HEAT_FIELD_H
@@ -0,0 +1,120 @@
+/**
+ * Particle Pool Implementation
+ */
+#include "ParticlePool.h"
+#include "../../utils/FixedMath.h"
+
+namespace {
+
+// Q16 seconds in deltaMs, so Q16 * Q16 >> 16 stays in Q16
+inline int32_t secondsQ16(uint32_t deltaMs) {
+    return (int32_t)(((uint64_t)deltaMs << 16) / 1000);
+}
+
+inline int32_t mulQ16(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a * b) >> 16);
+}
+
+} // namespace
+
+ParticlePool::ParticlePool(uint16_t capacity)
+    : pos(capacity), vel(capacity), accel(capacity), age(capacity), life(capacity),
+      width(capacity), color(capacity), live(0), lo(0), hi(0), edge(Edge::KILL),
+      drag(0), fadeOut(false) {}
+
+void ParticlePool::setBounds(int16_t low, int16_t high, Edge mode) {
+    lo = pixels(low);
+    hi = pixels(high);
+    edge = mode;
+}
+
+bool ParticlePool::spawn(int32_t p, int32_t v, const CRGB& c, uint16_t lifeMs, uint16_t w, int32_t a) {
+    if (live >= pos.size()) return false;
+    pos[live] = p;
+    vel[live] = v;
+    accel[live] = a;
+    age[live] = 0;
+    life[live] = lifeMs;
+    width[live] = w;
+    color[live] = c;
+    live++;
+    return true;
+}
+
+void ParticlePool::kill(uint16_t i) {
+    live--;
+    if (i == live) return;
+    pos[i] = pos[live];
+    vel[i] = vel[live];
+    accel[i] = accel[live];
+    age[i] = age[live];
+    life[i] = life[live];
+    width[i] = width[live];
+    color[i] = color[live];
+}
+
+void ParticlePool::update(uint32_t deltaMs) {
+    const int32_t dt = secondsQ16(deltaMs);
+    const int32_t keep = drag ? FixedMath::Q16_ONE - (int32_t)((int64_t)drag * dt >> 8) : FixedMath::Q16_ONE;
+    const int32_t span = hi - lo;
+    const uint16_t ageStep = deltaMs > 0xFFFF ? 0xFFFF : deltaMs;
+
+    uint16_t i = 0;
+    while (i < live) {
+        if (life[i]) {
+            const uint32_t older = (uint32_t)age[i] + ageStep;
+            age[i] = older > 0xFFFF ? 0xFFFF : older;
+            if (age[i] >= life[i]) {
+                kill(i);
+                continue; // Slot i now holds the former last particle
+            }
+        }
+
+        vel[i] += mulQ16(accel[i], dt);
+        if (drag) vel[i] = mulQ16(vel[i], keep > 0 ? keep : 0);
+        pos[i] += mulQ16(vel[i], dt);
+
+        if (span > 0 && (pos[i] < lo || pos[i] >= hi)) {
+            if (edge == Edge::KILL) {
+                kill(i);
+                continue;
+            } else if (edge == Edge::WRAP) {
+                pos[i] = lo + FixedMath::wrap(pos[i] - lo, span);
+            } else {
+                pos[i] = pos[i] < lo ? 2 * lo - pos[i] : 2 * (hi - 1) - pos[i];
+                pos[i] = constrain(pos[i], lo, hi - 1);
+                vel[i] = -vel[i];
+            }
+        }
+        i++;
+    }
+}
+
+void ParticlePool::render(CRGB* leds, uint16_t numLeds) const {
+    const int32_t stripEnd = (int32_t)numLeds << 16;
+    for (uint16_t i = 0; i < live; i++) {
+        CRGB c = color[i];
+        if (fadeOut && life[i]) c.nscale8_video(255 - (uint32_t)age[i] * 255 / life[i]);
+
+        // Box of `width` centred on pos, clipped to the strip
+        const int32_t half = (int32_t)width[i] << 7; // Q8 / 2 -> Q16
+        int32_t left = pos[i] - half;
+        int32_t right = pos[i] + half;
+        if (right <= 0 || left >= stripEnd) continue;
+        if (left < 0) left = 0;
+        if (right > stripEnd) right = stripEnd;
+
+        // Each pixel gets the part of the box it covers
+        const int16_t first = left >> 16;
+        const int16_t last = (right - 1) >> 16;
+        for (int16_t p = first; p <= last; p++) {
+            const int32_t cellStart = (int32_t)p << 16;
+            const int32_t cover = min(right, cellStart + 0x10000) - max(left, cellStart);
+            if (cover >= 0xFFFF) {
+                leds[p] += c;
+            } else if (cover > 0) {
+                leds[p] += CRGB(c).nscale8(cover >> 8);
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * Particle Pool
+ * Fixed-capacity 1D particle system in structure-of-arrays layout.
+ *
+ * Storage is allocated once in the constructor; spawning into a full pool
+ * drops the particle instead of growing, and dead particles are removed by
+ * moving the last live one into their slot, so the live range stays dense.
+ * Position and velocity are Q16 fixed point (pixels, pixels per second)
+ * and every particle is drawn additively with sub-pixel anti-aliasing in
+ * a single render() pass.
+ */
+#ifndef PARTICLE_POOL_H
+#define PARTICLE_POOL_H
+
+#include <FastLED.h>
+#include <vector>
+#include "../TimeMotion.h"
+
+class ParticlePool {
+public:
+    // What happens to a particle that leaves [lo, hi)
+    enum class Edge : uint8_t {
+        KILL,
+        WRAP,
+        BOUNCE
+    };
+
+    explicit ParticlePool(uint16_t capacity);
+
+    // Travel range in pixels; may extend past the strip for off-screen travel
+    void setBounds(int16_t lo, int16_t hi, Edge edge);
+    // Share of velocity lost per second, 0-255 = 0-100%
+    void setDrag(uint8_t perSecond) { drag = perSecond; }
+    // Scale brightness down linearly over each particle's lifetime
+    void setFadeOut(bool enabled) { fadeOut = enabled; }
+
+    // pos in Q16 pixels, vel in Q16 pixels/s, accel in Q16 pixels/s^2.
+    // width in Q8 pixels (256 = one pixel), lifeMs 0 = lives until killed.
+    // Returns false when the pool is full.
+    bool spawn(int32_t pos, int32_t vel, const CRGB& color, uint16_t lifeMs = 0,
+               uint16_t width = 256, int32_t accel = 0);
+
+    // Integrates motion, ages and culls particles
+    void update(uint32_t deltaMs);
+
+    // Adds every particle to leds[0, numLeds) with anti-aliased edges
+    void render(CRGB* leds, uint16_t numLeds) const;
+
+    void clear() { live = 0; }
+    uint16_t count() const { return live; }
+    uint16_t capacity() const { return (uint16_t)pos.size(); }
+
+    // Direct access to live particles, index < count()
+    int32_t position(uint16_t i) const { return pos[i]; }
+    int32_t velocity(uint16_t i) const { return vel[i]; }
+    void setVelocity(uint16_t i, int32_t v) { vel[i] = v; }
+    void setAcceleration(uint16_t i, int32_t a) { accel[i] = a; }
+
+    // Q16 helpers for the common units
+    static int32_t pixels(int16_t px) { return (int32_t)px * 65536; } // Off-strip bounds are negative
+    // Centre of pixel px, where a one-pixel particle lights exactly that pixel
+    static int32_t pixelCenter(int16_t px) { return pixels(px) + 0x8000; }
+    // Velocity that moves `px` pixels per nominal frame
+    static int32_t pixelsPerFrame(int16_t px) { return (int32_t)px * (1000 / NOMINAL_FRAME_MS) << 16; }
+
+private:
+    void kill(uint16_t i);
+
+    std::vector<int32_t> pos;
+    std::vector<int32_t> vel;
+    std::vector<int32_t> accel;
+    std::vector<uint16_t> age;
+    std::vector<uint16_t> life;
+    std::vector<uint16_t> width;
+    std::vector<CRGB> color;
+    uint16_t live;
+
+    int32_t lo;
+    int32_t hi;
+    Edge edge;
+    uint8_t drag;
+    bool fadeOut;
+};
+
+#endif // PARTICLE_POOL_H
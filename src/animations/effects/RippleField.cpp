@@ -0,0 +1,94 @@
+/**
+ * Ripple Field Implementation
+ */
+#include "RippleField.h"
+#include <algorithm>
+#include "../render/PaletteGather.h"
+
+RippleField::RippleField() : flip(false), numPixels(0), damping(250), speed(1), meanLevel(0) {}
+
+void RippleField::configure(uint16_t pixels) {
+    if (pixels == numPixels) return;
+    numPixels = pixels;
+    a.assign(numPixels, 0);
+    b.assign(numPixels, 0);
+    shade.assign(numPixels, 0);
+}
+
+void RippleField::clear() {
+    std::fill(a.begin(), a.end(), 0);
+    std::fill(b.begin(), b.end(), 0);
+    meanLevel = 0;
+}
+
+void RippleField::drop(uint16_t pos, int16_t amplitude, uint8_t radius) {
+    if (pos >= numPixels) return;
+    int16_t* cur = current();
+    int16_t* prev = previous();
+    const int16_t r = radius ? radius : 1;
+    // Twice a raised-cosine crest less one twice as wide: a smooth splash
+    // `amplitude` high with a shallow trough around it that adds no water.
+    // Each crest is a Hann window, reaching zero at +-w, so the splash has
+    // no step at its edges to ring through the field.
+    auto crest = [&](int16_t d, int16_t w) -> int32_t {
+        if (d < -w || d > w) return 0;
+        return (int32_t)amplitude * cos8((uint8_t)(d * 128 / w)) >> 8;
+    };
+    auto bump = [&](int16_t d) -> int32_t { return 2 * crest(d, r) - crest(d, 2 * r); };
+    for (int16_t d = -2 * r - 2; d <= 2 * r + 2; d++) {
+        const int32_t i = (int32_t)pos + d;
+        if (i < 0 || i >= numPixels) continue;
+        cur[i] = constrain(cur[i] + bump(d), -32767, 32767);
+        // The previous step is set a half step back in time, so the splash
+        // starts at rest and splits into two ripples
+        prev[i] = constrain(prev[i] + bump(d) + (bump(d - 1) + bump(d + 1) - 2 * bump(d)) / 4, -32767, 32767);
+    }
+}
+
+void RippleField::update(uint32_t deltaMs) {
+    if (stepTimer.perFrame(deltaMs, 1) == 0) return;
+    for (uint8_t s = 0; s < speed; s++) step();
+}
+
+void RippleField::step() {
+    if (numPixels < 2) return;
+    int16_t* cur = current();
+    int16_t* next = previous(); // Overwritten in place: prev[i] is only read at i
+    const uint16_t last = numPixels - 1;
+    // Drops add water; the mean level found last step is taken out of both
+    // buffers so the surface settles back to zero instead of rising
+    const int32_t offset = meanLevel;
+    int32_t sum = 0;
+    for (uint16_t i = 0; i <= last; i++) {
+        const int32_t left = cur[i > 0 ? i - 1 : 1];        // Reflecting ends
+        const int32_t right = cur[i < last ? i + 1 : last - 1];
+        // Wave speed 1/sqrt(2) pixel per step. Damping applies to the
+        // velocity (cur - prev) only; division rounds toward zero, so
+        // nothing drifts.
+        const int32_t h = cur[i] + ((int32_t)cur[i] - next[i]) * damping / 256 + (left + right - 2 * cur[i]) / 2;
+        next[i] = constrain(h - offset, -32767, 32767);
+        sum += next[i];
+        if (i > 0) cur[i - 1] -= offset; // No longer needed as a neighbour
+    }
+    cur[last] -= offset;
+    meanLevel = sum / numPixels;
+    flip = !flip;
+}
+
+void RippleField::render(CRGB* leds, const CRGBPalette16& palette, uint8_t brightness, bool crestsOnly) {
+    const int16_t* cur = current();
+    uint8_t* index = Render::gatherScratch();
+    for (uint16_t i = 0; i < numPixels; i++) {
+        const int32_t level = 128 + ((int32_t)cur[i] * 128 / FULL_SCALE);
+        index[i] = constrain(level, 0, 255);
+    }
+    if (!crestsOnly) {
+        Render::gatherPalette(leds, palette, index, 0, brightness, numPixels);
+        return;
+    }
+    for (uint16_t i = 0; i < numPixels; i++) {
+        const int32_t swell = abs(cur[i]) * 256 / FULL_SCALE;
+        shade[i] = scale8(brightness, swell > 255 ? 255 : swell);
+    }
+    Render::gatherPalette(leds, palette, index, 0, shade.data(), numPixels);
+}
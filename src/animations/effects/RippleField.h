@@ -0,0 +1,71 @@
+/**
+ * Ripple Field
+ * 1D damped wave equation on integer heights. Two height buffers hold the
+ * current and previous step; each step is one pass that writes the next
+ * heights over the previous ones:
+ *
+ *   next[i] = cur[i] + (cur[i] - prev[i]) * damping / 256
+ *           + (cur[i - 1] - 2 * cur[i] + cur[i + 1]) / 2
+ *
+ * a leapfrog scheme with the velocity (cur - prev) damped, at about 0.7
+ * pixels per step. Ends reflect. drop() adds a splash that splits into
+ * two ripples running outward; render() maps height through a palette,
+ * calm water at index 128.
+ * Cost per step is one short loop over numPixels, whatever is going on.
+ */
+#ifndef RIPPLE_FIELD_H
+#define RIPPLE_FIELD_H
+
+#include <FastLED.h>
+#include <vector>
+#include "../TimeMotion.h"
+
+class RippleField {
+public:
+    // Heights of about +-FULL_SCALE span the whole palette
+    static const int16_t FULL_SCALE = 8192;
+
+    RippleField();
+
+    // Sizes the buffers; clears the water when the size changes
+    void configure(uint16_t numPixels);
+
+    // Height kept per step out of 256; 255 rings for seconds, 240 settles fast
+    void setDamping(uint8_t keepPerStep) { damping = keepPerStep; }
+    // Steps per nominal frame (1-4); ripples cover about 0.7 pixels a step
+    void setSpeed(uint8_t stepsPerFrame) { speed = stepsPerFrame ? stepsPerFrame : 1; }
+
+    // Splash of the given crest height centred on pos, radius pixels either side
+    void drop(uint16_t pos, int16_t amplitude = FULL_SCALE, uint8_t radius = 2);
+
+    // Runs speed steps per nominal frame; a late frame still runs one
+    // frame's worth, so the cost per frame stays fixed
+    void update(uint32_t deltaMs);
+    void step();
+
+    // Height through the palette: 128 + height * 128 / FULL_SCALE, clamped.
+    // crestsOnly also dims pixels by their distance from calm, so still
+    // water goes dark whatever the palette shows at 128.
+    void render(CRGB* leds, const CRGBPalette16& palette, uint8_t brightness = 255, bool crestsOnly = false);
+
+    void clear();
+    int16_t operator[](uint16_t i) const { return current()[i]; }
+    uint16_t size() const { return numPixels; }
+
+private:
+    const int16_t* current() const { return flip ? b.data() : a.data(); }
+    int16_t* current() { return flip ? b.data() : a.data(); }
+    int16_t* previous() { return flip ? a.data() : b.data(); }
+
+    std::vector<int16_t> a;
+    std::vector<int16_t> b;
+    std::vector<uint8_t> shade;
+    bool flip;
+    uint16_t numPixels;
+    uint8_t damping;
+    uint8_t speed;
+    int16_t meanLevel;
+    RateAccumulator stepTimer;
+};
+
+#endif // RIPPLE_FIELD_H
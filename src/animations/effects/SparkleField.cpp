@@ -0,0 +1,106 @@
+/**
+ * Sparkle Field Implementation
+ */
+#include "SparkleField.h"
+
+namespace {
+const uint16_t UNLIT = 0xFFFF;
+}
+
+SparkleField::SparkleField()
+    : live(0), changedCount(0), numPixels(0), fadePeriod(NOMINAL_FRAME_MS), fullRedraw(true), lastBuffer(nullptr) {}
+
+void SparkleField::configure(uint16_t pixels, uint8_t fadeAmount, uint16_t fadePeriodMs, uint16_t maxLit) {
+    numPixels = pixels;
+    fadePeriod = fadePeriodMs ? fadePeriodMs : 1;
+    const uint16_t capacity = maxLit && maxLit < numPixels ? maxLit : numPixels;
+    pixel.assign(capacity, 0);
+    color.assign(capacity, CRGB::Black);
+    age.assign(capacity, 0);
+    slot.assign(numPixels, UNLIT);
+    expired.clear();
+    expired.reserve(capacity);
+    changedList.assign(capacity * 2, 0); // Every lit pixel plus as many expired
+    changedCount = 0;
+
+    // Level left after k fades, cut off once it is too dim to show
+    decay.clear();
+    uint8_t level = 255;
+    while (level >= 2 && decay.size() < 255) {
+        decay.push_back(level);
+        level = scale8(level, 255 - fadeAmount);
+    }
+    clear();
+}
+
+void SparkleField::clear() {
+    for (uint16_t s = 0; s < live; s++) slot[pixel[s]] = UNLIT;
+    live = 0;
+    expired.clear();
+    lastBuffer = nullptr;
+}
+
+CRGB SparkleField::shown(uint16_t s) const {
+    CRGB c = color[s];
+    if (age[s] > 0) c.nscale8(decay[age[s]]);
+    return c;
+}
+
+bool SparkleField::light(uint16_t i, const CRGB& add) {
+    if (i >= numPixels) return false;
+    uint16_t s = slot[i];
+    if (s != UNLIT) {
+        color[s] = shown(s) + add;
+    } else {
+        if (live >= pixel.size()) return false;
+        s = live++;
+        slot[i] = s;
+        pixel[s] = i;
+        color[s] = add;
+    }
+    age[s] = 0;
+    return true;
+}
+
+void SparkleField::update(uint32_t deltaMs) {
+    const uint32_t steps = fadeClock.advance(deltaMs, 1, fadePeriod);
+    if (steps == 0) return;
+    for (uint16_t s = 0; s < live;) {
+        const uint32_t next = age[s] + steps;
+        if (next >= decay.size()) {
+            remove(s); // Moves the last lit pixel into s
+            continue;
+        }
+        age[s] = next;
+        s++;
+    }
+}
+
+void SparkleField::remove(uint16_t s) {
+    expired.push_back(pixel[s]);
+    slot[pixel[s]] = UNLIT;
+    if (--live != s) {
+        pixel[s] = pixel[live];
+        color[s] = color[live];
+        age[s] = age[live];
+        slot[pixel[s]] = s;
+    }
+}
+
+void SparkleField::render(CRGB* leds) {
+    changedCount = 0;
+    fullRedraw = leds != lastBuffer;
+    if (fullRedraw) {
+        fill_solid(leds, numPixels, CRGB::Black);
+        lastBuffer = leds;
+    }
+    for (uint16_t p : expired) {
+        leds[p] = CRGB::Black;
+        if (changedCount < changedList.size()) changedList[changedCount++] = p;
+    }
+    expired.clear();
+    for (uint16_t s = 0; s < live; s++) {
+        leds[pixel[s]] = shown(s);
+        if (changedCount < changedList.size()) changedList[changedCount++] = pixel[s];
+    }
+}
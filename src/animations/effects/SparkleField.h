@@ -0,0 +1,71 @@
+/**
+ * Sparkle Field
+ * Sparse renderer for looks that light a few pixels at a time and let them
+ * fade: twinkles, confetti, star fields. Only lit pixels are stored, each
+ * with the colour it was lit with and its age; brightness comes from a
+ * decay table built once, so the per-frame cost follows the number of lit
+ * pixels instead of the strip length. Pixels that go dark are written black
+ * once and then forgotten.
+ *
+ * render() only writes lit and just-expired pixels and keeps the list of
+ * them, so the rest of the buffer must be left alone between frames.
+ */
+#ifndef SPARKLE_FIELD_H
+#define SPARKLE_FIELD_H
+
+#include <FastLED.h>
+#include <vector>
+#include "../TimeMotion.h"
+
+class SparkleField {
+public:
+    SparkleField();
+
+    // Pixels fade as if fadeToBlackBy(leds, n, fadeAmount) ran every
+    // fadePeriodMs. maxLit caps the lit pixels (0 = the whole strip).
+    void configure(uint16_t numLeds, uint8_t fadeAmount, uint16_t fadePeriodMs = NOMINAL_FRAME_MS, uint16_t maxLit = 0);
+
+    // Adds color on top of what pixel i shows now and restarts its fade.
+    // Returns false when the field is full.
+    bool light(uint16_t i, const CRGB& color);
+
+    // Ages every lit pixel and drops the ones that have faded out
+    void update(uint32_t deltaMs);
+
+    // Writes lit and just-expired pixels. A buffer other than last time's
+    // is cleared in full first, since its contents are unknown.
+    void render(CRGB* leds);
+
+    // Forgets every lit pixel; the next render() clears the whole buffer
+    void clear();
+
+    uint16_t litCount() const { return live; }
+
+    // Pixels the last render() wrote; false when it rewrote the whole buffer
+    bool changed(const uint16_t*& list, uint16_t& count) const {
+        list = changedList.data();
+        count = changedCount;
+        return !fullRedraw;
+    }
+
+private:
+    CRGB shown(uint16_t s) const;
+    void remove(uint16_t s);
+
+    std::vector<uint16_t> pixel;       // Lit pixels, dense in [0, live)
+    std::vector<CRGB> color;           // Colour when lit
+    std::vector<uint8_t> age;          // Fade periods since lit
+    std::vector<uint16_t> slot;        // Pixel -> index in the lists, or UNLIT
+    std::vector<uint16_t> expired;     // Gone dark since the last render
+    std::vector<uint16_t> changedList;
+    std::vector<uint8_t> decay;        // Brightness by age
+    uint16_t live;
+    uint16_t changedCount;
+    uint16_t numPixels;
+    uint16_t fadePeriod;
+    bool fullRedraw;
+    CRGB* lastBuffer;
+    RateAccumulator fadeClock;
+};
+
+#endif // SPARKLE_FIELD_H
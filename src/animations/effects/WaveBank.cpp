@@ -0,0 +1,65 @@
+/**
+ * Wave Bank Implementation
+ */
+#include "WaveBank.h"
+
+namespace {
+
+// Shape tables, filled from FastLED's own functions so samples match them
+uint8_t sineTable[256];
+uint8_t cubicTable[256];
+uint8_t triangleTable[256];
+bool tablesReady = false;
+
+void buildTables() {
+    for (uint16_t a = 0; a < 256; a++) {
+        sineTable[a] = sin8(a);
+        cubicTable[a] = cubicwave8(a);
+        triangleTable[a] = triwave8(a);
+    }
+    tablesReady = true;
+}
+
+const uint8_t* tableFor(WaveBank::Shape shape) {
+    switch (shape) {
+        case WaveBank::Shape::CUBIC: return cubicTable;
+        case WaveBank::Shape::TRIANGLE: return triangleTable;
+        default: return sineTable;
+    }
+}
+
+} // namespace
+
+uint8_t WaveBank::add(Shape shape, uint8_t stepPerPixel, int8_t speedPerFrame, uint8_t phase, uint8_t floor) {
+    if (!tablesReady) buildTables();
+    if (count >= MAX_WAVES) return MAX_WAVES - 1;
+    waves[count] = {shape, angle(phase), angle(stepPerPixel), speedPerFrame * (1 << 24), floor};
+    return count++;
+}
+
+void WaveBank::advance(uint32_t deltaMs) {
+    // Elapsed nominal frames in Q8, the remainder carried to the next call
+    const int64_t framesQ8 = clock.advance(deltaMs, 256, NOMINAL_FRAME_MS);
+    if (framesQ8 == 0) return;
+    for (uint8_t i = 0; i < count; i++) {
+        waves[i].phase += (uint32_t)(((int64_t)waves[i].speed * framesQ8) >> 8);
+    }
+}
+
+void WaveBank::render(uint8_t i, uint8_t* out, uint16_t n, uint8_t stride, bool accumulate) const {
+    const Wave& w = waves[i];
+    const uint8_t* table = tableFor(w.shape);
+    uint32_t p = w.phase;
+    if (w.floor == 0 && !accumulate) {
+        for (uint16_t k = 0; k < n; k++, p += w.step, out += stride) *out = table[p >> 24];
+    } else if (!accumulate) {
+        for (uint16_t k = 0; k < n; k++, p += w.step, out += stride) *out = qsub8(table[p >> 24], w.floor);
+    } else {
+        for (uint16_t k = 0; k < n; k++, p += w.step, out += stride) *out += qsub8(table[p >> 24], w.floor);
+    }
+}
+
+uint8_t WaveBank::sample(uint8_t i, uint16_t k) const {
+    const Wave& w = waves[i];
+    return qsub8(tableFor(w.shape)[(w.phase + w.step * k) >> 24], w.floor);
+}
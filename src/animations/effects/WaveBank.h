@@ -0,0 +1,63 @@
+/**
+ * Wave Bank
+ * Sum-of-sines engine built on phase accumulators. Each wave keeps its
+ * phase at pixel 0 and a per-pixel phase step, so rendering a span is one
+ * addition and one table read per pixel, and moving the wave over time is
+ * one addition per frame. Replaces per-pixel sin8(k * freq + phase) terms.
+ *
+ * Phases are 32-bit with one period spanning the full range: the top byte
+ * is the sin8()-style angle and the rest is sub-step precision.
+ */
+#ifndef WAVE_BANK_H
+#define WAVE_BANK_H
+
+#include <FastLED.h>
+#include "../TimeMotion.h"
+
+class WaveBank {
+public:
+    static const uint8_t MAX_WAVES = 4;
+
+    enum class Shape : uint8_t {
+        SINE,      // sin8()
+        CUBIC,     // cubicwave8()
+        TRIANGLE   // triwave8()
+    };
+
+    struct Wave {
+        Shape shape;
+        uint32_t phase;  // At pixel 0
+        uint32_t step;   // Per pixel
+        int32_t speed;   // Per nominal frame
+        uint8_t floor;   // Subtracted from every sample, clamped at 0
+    };
+
+    WaveBank() : count(0) {}
+
+    // Angles in sin8() units (256 = one period). Returns the wave's index.
+    uint8_t add(Shape shape, uint8_t stepPerPixel, int8_t speedPerFrame, uint8_t phase = 0, uint8_t floor = 0);
+
+    Wave& operator[](uint8_t i) { return waves[i]; }
+    const Wave& operator[](uint8_t i) const { return waves[i]; }
+    uint8_t size() const { return count; }
+
+    // Moves every wave by its speed over deltaMs
+    void advance(uint32_t deltaMs);
+
+    // Writes wave `i` for pixels [0, n) to out[0], out[stride], ... When
+    // accumulate is set the samples are added (wrapping, like uint8_t sums).
+    void render(uint8_t i, uint8_t* out, uint16_t n, uint8_t stride = 1, bool accumulate = false) const;
+
+    // Sample of wave `i` at pixel k, for spot checks
+    uint8_t sample(uint8_t i, uint16_t k) const;
+
+    // Whole-unit angle to the 32-bit phase format
+    static uint32_t angle(uint8_t a) { return (uint32_t)a << 24; }
+
+private:
+    Wave waves[MAX_WAVES];
+    uint8_t count;
+    RateAccumulator clock;
+};
+
+#endif // WAVE_BANK_H
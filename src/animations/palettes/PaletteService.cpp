@@ -0,0 +1,264 @@
+/**
+ * Palette Service Implementation
+ */
+#include "PaletteService.h"
+#include <algorithm>
+#include "../../config/Config.h"
+
+namespace Palettes {
+
+const TProgmemRGBPalette16 Festival_p FL_PROGMEM = {
+    CRGB::Purple, CRGB::HotPink, CRGB::Cyan, CRGB::Lime,
+    CRGB::BlueViolet, CRGB::Magenta, CRGB::Turquoise, CRGB::GreenYellow,
+    CRGB::Indigo, CRGB::DeepPink, CRGB::SkyBlue, CRGB::Chartreuse,
+    CRGB::DarkViolet, CRGB::Fuchsia, CRGB::DodgerBlue, CRGB::SpringGreen
+};
+
+const TProgmemRGBPalette16 Wonder_p FL_PROGMEM = {
+    CRGB::Lavender, CRGB::LightPink, CRGB::LightSkyBlue, CRGB::PaleGreen,
+    CRGB::Violet, CRGB::Pink, CRGB::SkyBlue, CRGB::MintCream,
+    CRGB::Orchid, CRGB::HotPink, CRGB::Turquoise, CRGB::LimeGreen,
+    CRGB::Purple, CRGB::DeepPink, CRGB::DodgerBlue, CRGB::SpringGreen
+};
+
+const TProgmemRGBPalette16 Aurora_p FL_PROGMEM = {
+    0x006400, 0x009600, 0x00C800, 0x00FF00,
+    0x6400C8, 0x9600FF, 0xC800FF, 0xFF00FF,
+    0x003296, 0x0064C8, 0x0096FF, 0x00C8FF,
+    0x000000, 0x000000, 0x000000, 0x000000
+};
+
+const TProgmemRGBPalette16 Night_p FL_PROGMEM = {
+    0x000014, 0x000028, 0x00003C, 0x0A0050,
+    0x140064, 0x1E0078, 0x28008C, 0x3200A0,
+    0x3C00B4, 0x4600C8, 0x5000DC, 0x5A00F0,
+    0x6400FF, 0x7814FF, 0x8C28FF, 0xA03CFF
+};
+
+const TProgmemRGBPalette16 Twilight_p FL_PROGMEM = {
+    CRGB::Blue, CRGB::Purple, 0x008080, 0x006400,
+    0x000080, 0x4B0082, CRGB::Cyan, 0x228B22,
+    CRGB::Blue, CRGB::Purple, 0x008080, 0x006400,
+    0x000080, 0x4B0082, CRGB::Cyan, 0x228B22
+};
+
+const TProgmemRGBPalette16 Starlit_p FL_PROGMEM = {
+    CRGB::Blue, CRGB::Purple, 0x4682B4, 0xC8FFFF,
+    0x000080, 0x4B0082, 0x87CEEB, CRGB::Gray,
+    CRGB::Blue, CRGB::Purple, 0x4682B4, 0xC8FFFF,
+    0x000080, 0x4B0082, 0x87CEEB, CRGB::Gray
+};
+
+namespace {
+// {hue, sat, val} per entry; every palette repeats its first 8 entries
+const uint8_t HSV_PALETTES[HSV_PALETTE_COUNT][8][3] FL_PROGMEM = {
+    // SOFT_FLAME
+    {{0, 255, 100}, {10, 255, 180}, {20, 200, 255}, {25, 180, 255},
+     {30, 180, 200}, {40, 150, 150}, {20, 255, 255}, {10, 200, 180}},
+    // SUNSET_GLOW
+    {{5, 255, 255}, {15, 200, 255}, {25, 150, 230}, {35, 180, 200},
+     {10, 150, 220}, {20, 180, 240}, {30, 160, 255}, {40, 180, 255}},
+    // WARM_DREAM
+    {{0, 0, 100}, {10, 30, 150}, {20, 50, 200}, {30, 80, 220},
+     {40, 100, 255}, {20, 80, 240}, {10, 50, 220}, {5, 30, 180}},
+    // WIZARD
+    {{180, 255, 255}, {200, 255, 200}, {160, 255, 255}, {180, 200, 255},
+     {190, 255, 255}, {170, 255, 180}, {210, 200, 255}, {160, 180, 200}},
+    // LIZARD
+    {{85, 255, 255}, {100, 200, 255}, {120, 255, 200}, {90, 255, 180},
+     {110, 255, 255}, {100, 255, 255}, {130, 255, 180}, {85, 180, 200}}
+};
+} // namespace
+
+} // namespace Palettes
+
+namespace {
+
+struct PoolSlot {
+    CRGBPalette16 palette;
+    uint8_t refs;
+};
+
+PoolSlot pool[PALETTE_POOL_SIZE];
+const CRGBPalette16 fallbackPalette = RainbowColors_p; // Handed out when the pool is full
+
+PaletteBlend* blendList = nullptr;
+uint32_t lastTickMicros = 0;
+uint32_t maxTickMicros = 0;
+
+int8_t acquireSlot(const CRGBPalette16& palette) {
+    int8_t freeSlot = -1;
+    for (int8_t i = 0; i < PALETTE_POOL_SIZE; i++) {
+        if (pool[i].refs == 0) {
+            if (freeSlot < 0) freeSlot = i;
+        } else if (pool[i].palette == palette) {
+            pool[i].refs++;
+            return i;
+        }
+    }
+    if (freeSlot < 0) {
+        Serial.println(F("[PALETTE] Shared pool full, using fallback palette"));
+        return -1;
+    }
+    pool[freeSlot].palette = palette;
+    pool[freeSlot].refs = 1;
+    return freeSlot;
+}
+
+// One nblendPaletteTowardPalette() step for a single channel
+inline bool stepChannel(uint8_t& value, uint8_t target) {
+    if (value == target) return false;
+    if (value < target) {
+        value++;
+    } else {
+        value--;
+        if (value > target) value--;
+    }
+    return true;
+}
+
+} // namespace
+
+// ---------------------- SharedPalette ----------------------
+
+SharedPalette::SharedPalette(const CRGBPalette16& palette) : slot(acquireSlot(palette)) {}
+
+SharedPalette::SharedPalette(const SharedPalette& other) : slot(other.slot) {
+    if (slot != NO_SLOT) pool[slot].refs++;
+}
+
+SharedPalette& SharedPalette::operator=(const SharedPalette& other) {
+    if (this != &other) {
+        if (other.slot != NO_SLOT) pool[other.slot].refs++;
+        release();
+        slot = other.slot;
+    }
+    return *this;
+}
+
+SharedPalette SharedPalette::fromHsv(Palettes::HsvId id) {
+    CRGBPalette16 palette;
+    for (uint8_t i = 0; i < 16; i++) {
+        const uint8_t* hsv = Palettes::HSV_PALETTES[id][i & 7];
+        palette.entries[i] = CHSV(hsv[0], hsv[1], hsv[2]);
+    }
+    return SharedPalette(palette);
+}
+
+const CRGBPalette16& SharedPalette::get() const {
+    return slot == NO_SLOT ? fallbackPalette : pool[slot].palette;
+}
+
+void SharedPalette::release() {
+    if (slot != NO_SLOT && pool[slot].refs > 0) pool[slot].refs--;
+    slot = NO_SLOT;
+}
+
+// ---------------------- PaletteBlend ----------------------
+
+PaletteBlend::PaletteBlend(const CRGBPalette16& start)
+    : current(start), target(start), periodMs(NOMINAL_FRAME_MS), pendingChanges(0),
+      changesPerStep(48), cursor(0), next(blendList) {
+    blendList = this;
+}
+
+PaletteBlend::~PaletteBlend() {
+    for (PaletteBlend** link = &blendList; *link; link = &(*link)->next) {
+        if (*link == this) {
+            *link = next;
+            break;
+        }
+    }
+}
+
+void PaletteBlend::setTarget(const CRGBPalette16& palette) {
+    target = palette;
+}
+
+void PaletteBlend::setRate(uint8_t changes, uint16_t period) {
+    changesPerStep = changes;
+    periodMs = period ? period : 1;
+}
+
+void PaletteBlend::jumpToTarget() {
+    current = target;
+    pendingChanges = 0;
+}
+
+uint8_t PaletteBlend::service(uint8_t budget) {
+    uint8_t used = 0;
+    uint8_t idle = 0; // Entries in a row that already matched
+    while (pendingChanges > 0 && used < budget && idle < 16) {
+        uint8_t* cur = current.entries[cursor].raw;
+        const uint8_t* tgt = target.entries[cursor].raw;
+        bool changed = false;
+        for (uint8_t c = 0; c < 3 && pendingChanges > 0; c++) {
+            if (stepChannel(cur[c], tgt[c])) {
+                pendingChanges--;
+                changed = true;
+            }
+        }
+        idle = changed ? 0 : idle + 1;
+        cursor = (cursor + 1) & 15;
+        used++;
+    }
+    // Reached the target; checked directly, since with several blends
+    // sharing the budget a pass may end before 16 idle entries in a row
+    if (idle >= 16 || current == target) pendingChanges = 0;
+    return used;
+}
+
+// ---------------------- PaletteService ----------------------
+
+void PaletteService::tick(uint32_t deltaMs) {
+    const uint32_t start = micros();
+    uint8_t active = 0;
+    for (PaletteBlend* b = blendList; b; b = b->next) {
+        const uint32_t steps = b->stepRate.advance(deltaMs, 1, b->periodMs);
+        if (b->current == b->target) {
+            b->pendingChanges = 0;
+        } else if (steps) {
+            // Cap the backlog at two full passes so a stall can't queue minutes of work
+            b->pendingChanges = std::min<uint32_t>(b->pendingChanges + steps * b->changesPerStep, 96);
+        }
+        if (b->pendingChanges) active++;
+    }
+
+    if (active) {
+        const uint8_t share = std::max<uint8_t>(4, PALETTE_BLEND_BUDGET / active);
+        for (PaletteBlend* b = blendList; b; b = b->next) {
+            if (b->pendingChanges) b->service(share);
+        }
+    }
+
+    lastTickMicros = micros() - start;
+    if (lastTickMicros > maxTickMicros) maxTickMicros = lastTickMicros;
+}
+
+PaletteService::Stats PaletteService::stats() {
+    Stats s = {};
+    for (uint8_t i = 0; i < PALETTE_POOL_SIZE; i++) {
+        if (pool[i].refs == 0) continue;
+        s.sharedSlots++;
+        s.sharedRefs += pool[i].refs;
+    }
+    s.bytesShared = (s.sharedRefs - s.sharedSlots) * sizeof(CRGBPalette16);
+    for (PaletteBlend* b = blendList; b; b = b->next) {
+        if (b->blending()) s.activeBlends++;
+    }
+    s.lastTickMicros = lastTickMicros;
+    s.maxTickMicros = maxTickMicros;
+    return s;
+}
+
+void PaletteService::printStats() {
+    const Stats s = stats();
+    Serial.print(F("[PALETTE] slots: ")); Serial.print(s.sharedSlots);
+    Serial.print(F("/")); Serial.print(PALETTE_POOL_SIZE);
+    Serial.print(F(" refs: ")); Serial.print(s.sharedRefs);
+    Serial.print(F(" bytes shared: ")); Serial.print(s.bytesShared);
+    Serial.print(F(" blends: ")); Serial.print(s.activeBlends);
+    Serial.print(F(" tick us: ")); Serial.print(s.lastTickMicros);
+    Serial.print(F(" (max ")); Serial.print(s.maxTickMicros);
+    Serial.println(F(")"));
+}
@@ -0,0 +1,112 @@
+/**
+ * Palette Service
+ * Keeps palettes out of RAM where possible and blends them incrementally.
+ *
+ * - Fixed theme palettes live in flash (Palettes::*_p) and go straight to
+ *   ColorFromPalette() like FastLED's own *_p palettes.
+ * - Palettes that must be expanded at runtime (HSV-authored ones, random
+ *   ones) are SharedPalette handles: identical palettes share one pool
+ *   slot, and the slot is freed with the last handle.
+ * - PaletteBlend moves a working palette toward a target. The blends are
+ *   advanced together by PaletteService::tick() once per frame within a
+ *   fixed entry budget, instead of each animation blending whole palettes
+ *   whenever its timer fires.
+ */
+#ifndef PALETTE_SERVICE_H
+#define PALETTE_SERVICE_H
+
+#include <FastLED.h>
+#include "../TimeMotion.h"
+
+namespace Palettes {
+    // Flash-resident RGB palettes used by the themes
+    extern const TProgmemRGBPalette16 Festival_p;
+    extern const TProgmemRGBPalette16 Wonder_p;
+    extern const TProgmemRGBPalette16 Aurora_p;
+    extern const TProgmemRGBPalette16 Night_p;
+    extern const TProgmemRGBPalette16 Twilight_p;
+    extern const TProgmemRGBPalette16 Starlit_p;
+
+    // Flash-resident HSV palettes, expanded through SharedPalette::fromHsv()
+    enum HsvId : uint8_t {
+        SOFT_FLAME,
+        SUNSET_GLOW,
+        WARM_DREAM,
+        WIZARD,
+        LIZARD,
+        HSV_PALETTE_COUNT
+    };
+}
+
+// Reference-counted handle to a palette in the shared pool
+class SharedPalette {
+public:
+    SharedPalette() : slot(NO_SLOT) {}
+    explicit SharedPalette(const CRGBPalette16& palette);
+    SharedPalette(const SharedPalette& other);
+    SharedPalette& operator=(const SharedPalette& other);
+    ~SharedPalette() { release(); }
+
+    static SharedPalette fromHsv(Palettes::HsvId id);
+
+    const CRGBPalette16& get() const;
+    operator const CRGBPalette16&() const { return get(); }
+
+private:
+    static const int8_t NO_SLOT = -1;
+    void release();
+    int8_t slot;
+};
+
+// A working palette that PaletteService walks toward a target. Rate follows
+// nblendPaletteTowardPalette(): up to `changes` one-step channel moves per
+// `periodMs`, spread over frames instead of applied in one burst.
+class PaletteBlend {
+public:
+    explicit PaletteBlend(const CRGBPalette16& start);
+    ~PaletteBlend();
+
+    void setTarget(const CRGBPalette16& palette);
+    void setRate(uint8_t changes, uint16_t periodMs);
+    void jumpToTarget();
+    bool blending() const { return pendingChanges > 0 || current != target; }
+
+    const CRGBPalette16& get() const { return current; }
+    operator const CRGBPalette16&() const { return current; }
+
+private:
+    friend class PaletteService;
+    PaletteBlend(const PaletteBlend&) = delete;
+    PaletteBlend& operator=(const PaletteBlend&) = delete;
+
+    // Applies up to `budget` entries of pending work, returns entries used
+    uint8_t service(uint8_t budget);
+
+    CRGBPalette16 current;
+    CRGBPalette16 target;
+    RateAccumulator stepRate;
+    uint16_t periodMs;
+    uint16_t pendingChanges;
+    uint8_t changesPerStep;
+    uint8_t cursor;
+    PaletteBlend* next;
+};
+
+class PaletteService {
+public:
+    struct Stats {
+        uint8_t sharedSlots;      // Pool slots in use
+        uint8_t sharedRefs;       // Handles pointing at them
+        uint16_t bytesShared;     // RAM the sharing saves over one copy per handle
+        uint8_t activeBlends;
+        uint32_t lastTickMicros;  // Blend cost of the last frame
+        uint32_t maxTickMicros;
+    };
+
+    // Advances every registered PaletteBlend; call once per frame
+    static void tick(uint32_t deltaMs);
+    static Stats stats();
+    static void printStats();
+};
+
+#endif // PALETTE_SERVICE_H
@@ -0,0 +1,122 @@
+/**
+ * HSV Span Kernels Implementation
+ *
+ * hsv2rgb_rainbow() applies value last, as scale8(channel, scale8_video(v, v)).
+ * Ramps are therefore built at full value and keyed by saturation only.
+ */
+#include "HsvKernels.h"
+#include "../../config/Config.h"
+
+namespace {
+
+struct HueRamp {
+    CRGB colors[256];
+    uint8_t sat;
+    uint8_t lastUse; // 0 = empty
+};
+
+HueRamp ramps[HUE_RAMP_SLOTS];
+uint8_t useClock = 0;
+
+// Ramp for `sat`, rebuilding the least recently used slot on a miss
+const CRGB* rampFor(uint8_t sat) {
+    if (++useClock == 0) {
+        // Restart the clock, renumbering used slots 1..N in their LRU order
+        uint8_t rank[HUE_RAMP_SLOTS];
+        uint8_t used = 0;
+        for (uint8_t i = 0; i < HUE_RAMP_SLOTS; i++) {
+            rank[i] = 0;
+            if (!ramps[i].lastUse) continue;
+            used++;
+            for (const HueRamp& r : ramps) {
+                if (r.lastUse && r.lastUse <= ramps[i].lastUse) rank[i]++;
+            }
+        }
+        for (uint8_t i = 0; i < HUE_RAMP_SLOTS; i++) ramps[i].lastUse = rank[i];
+        useClock = used + 1;
+    }
+    HueRamp* victim = &ramps[0];
+    for (HueRamp& r : ramps) {
+        if (r.lastUse && r.sat == sat) {
+            r.lastUse = useClock;
+            return r.colors;
+        }
+        if (r.lastUse < victim->lastUse) victim = &r;
+    }
+    for (uint16_t h = 0; h < 256; h++) {
+        hsv2rgb_rainbow(CHSV(h, sat, 255), victim->colors[h]);
+    }
+    victim->sat = sat;
+    victim->lastUse = useClock;
+    return victim->colors;
+}
+
+// The value step of hsv2rgb_rainbow(), with `scale` = scale8_video(val, val)
+inline CRGB applyValue(const CRGB& c, uint8_t scale) {
+    return CRGB(scale8(c.r, scale), scale8(c.g, scale), scale8(c.b, scale));
+}
+
+inline uint8_t valueScale(uint8_t val) {
+    return scale8_video(val, val);
+}
+
+} // namespace
+
+namespace Render {
+
+void fillHue(CRGB* out, uint16_t count, uint8_t startHue, uint8_t deltaHue, uint8_t sat, uint8_t val) {
+    const CRGB* ramp = rampFor(sat);
+    uint8_t hue = startHue;
+    if (val == 255) {
+        for (uint16_t i = 0; i < count; i++, hue += deltaHue) out[i] = ramp[hue];
+        return;
+    }
+    const uint8_t scale = valueScale(val);
+    if (scale == 0) {
+        fill_solid(out, count, CRGB::Black);
+        return;
+    }
+    for (uint16_t i = 0; i < count; i++, hue += deltaHue) out[i] = applyValue(ramp[hue], scale);
+}
+
+void addHue(CRGB* out, uint16_t count, uint8_t startHue, uint8_t deltaHue, uint8_t sat, uint8_t val, uint16_t stride) {
+    const uint8_t scale = val == 255 ? 255 : valueScale(val);
+    if (scale == 0 || stride == 0) return;
+    const CRGB* ramp = rampFor(sat);
+    const uint8_t hueStride = deltaHue * stride;
+    uint8_t hue = startHue;
+    for (uint16_t i = 0; i < count; i += stride, hue += hueStride) {
+        out[i] += val == 255 ? ramp[hue] : applyValue(ramp[hue], scale);
+    }
+}
+
+void hsvToRgb(CRGB* out, const uint8_t* hues, uint8_t hueOffset, uint8_t sat, uint8_t val, uint16_t count) {
+    const CRGB* ramp = rampFor(sat);
+    if (val == 255) {
+        for (uint16_t i = 0; i < count; i++) out[i] = ramp[(uint8_t)(hues[i] + hueOffset)];
+        return;
+    }
+    const uint8_t scale = valueScale(val);
+    for (uint16_t i = 0; i < count; i++) out[i] = applyValue(ramp[(uint8_t)(hues[i] + hueOffset)], scale);
+}
+
+void hsvToRgb(CRGB* out, const uint8_t* hues, uint8_t hueOffset, uint8_t sat, const uint8_t* vals, uint16_t count) {
+    const CRGB* ramp = rampFor(sat);
+    for (uint16_t i = 0; i < count; i++) {
+        const CRGB& c = ramp[(uint8_t)(hues[i] + hueOffset)];
+        out[i] = vals[i] == 255 ? c : applyValue(c, valueScale(vals[i]));
+    }
+}
+
+void shadeHue(CRGB* out, uint8_t hue, uint8_t sat, const uint8_t* vals, uint16_t count, bool accumulate) {
+    const CRGB c = rampFor(sat)[hue];
+    if (accumulate) {
+        for (uint16_t i = 0; i < count; i++) {
+            if (vals[i]) out[i] += vals[i] == 255 ? c : applyValue(c, valueScale(vals[i]));
+        }
+        return;
+    }
+    for (uint16_t i = 0; i < count; i++) out[i] = vals[i] == 255 ? c : applyValue(c, valueScale(vals[i]));
+}
+
+} // namespace Render
@@ -0,0 +1,36 @@
+/**
+ * HSV Span Kernels
+ * Batched CHSV-to-CRGB for whole spans. For a fixed saturation, every hue
+ * is converted once into a cached 256-entry ramp; value is applied to the
+ * ramp entry with the same scaling hsv2rgb_rainbow() uses, so the results
+ * match `leds[i] = CHSV(h, s, v)` exactly while skipping the per-pixel
+ * hue math.
+ */
+#ifndef HSV_KERNELS_H
+#define HSV_KERNELS_H
+
+#include <FastLED.h>
+
+namespace Render {
+    // out[i] = CHSV(startHue + i * deltaHue, sat, val)
+    void fillHue(CRGB* out, uint16_t count, uint8_t startHue, uint8_t deltaHue, uint8_t sat = 255, uint8_t val = 255);
+
+    // Drop-in for FastLED's fill_rainbow(), which uses saturation 240
+    inline void fillRainbow(CRGB* out, uint16_t count, uint8_t startHue, uint8_t deltaHue = 5) {
+        fillHue(out, count, startHue, deltaHue, 240, 255);
+    }
+
+    // out[i] += CHSV(startHue + i * deltaHue, sat, val) for every stride-th pixel
+    void addHue(CRGB* out, uint16_t count, uint8_t startHue, uint8_t deltaHue, uint8_t sat, uint8_t val, uint16_t stride = 1);
+
+    // out[i] = CHSV(hues[i] + hueOffset, sat, val)
+    void hsvToRgb(CRGB* out, const uint8_t* hues, uint8_t hueOffset, uint8_t sat, uint8_t val, uint16_t count);
+
+    // Same with a per-pixel value array
+    void hsvToRgb(CRGB* out, const uint8_t* hues, uint8_t hueOffset, uint8_t sat, const uint8_t* vals, uint16_t count);
+
+    // out[i] = CHSV(hue, sat, vals[i]), or added to out[i] when accumulate
+    void shadeHue(CRGB* out, uint8_t hue, uint8_t sat, const uint8_t* vals, uint16_t count, bool accumulate = false);
+}
+
+#endif // HSV_KERNELS_H
@@ -0,0 +1,113 @@
+/**
+ * Noise Field Implementation
+ */
+#include "NoiseField.h"
+
+namespace {
+// Lattice sample every quarter noise cell in space, every eighth in time.
+// inoise8 cells are 256 units wide, so linear interpolation at this density
+// stays within a few steps of the real curve.
+const uint16_t TARGET_SPACING = 64;
+const uint8_t BASE_Z_SHIFT = 5;
+// Extra samples so a drifting origin doesn't force a new lattice every frame
+const uint16_t LATTICE_MARGIN = 8;
+}
+
+NoiseField::NoiseField()
+    : numPixels(0), scale(0), spacing(1), fracRecip(0), needed(0), octaves(1),
+      zShift(BASE_Z_SHIFT), pixelLattice(false), latticePhase(0), kBase(0), z0(0), primed(false) {}
+
+void NoiseField::configure(uint16_t pixels, uint16_t noiseScale, uint8_t octaveCount) {
+    if (noiseScale == 0) noiseScale = 1;
+    if (octaveCount == 0) octaveCount = 1;
+    if (octaveCount > 4) octaveCount = 4;
+    if (primed && pixels == numPixels && noiseScale == scale && octaveCount == octaves) return;
+
+    numPixels = pixels;
+    scale = noiseScale;
+    octaves = octaveCount;
+
+    // Finer lattice for finer octaves; whole pixels per sample so the span
+    // walk never skips a sample
+    const uint16_t target = TARGET_SPACING >> (octaves - 1);
+    uint16_t stride = 1;
+    while ((uint32_t)scale * stride * 2 <= target) stride *= 2;
+    spacing = scale * stride;
+    // Pixels further apart than the target can't be interpolated between:
+    // keep the lattice on the pixels themselves (time coherence only)
+    pixelLattice = spacing > target;
+    latticePhase = 0;
+    fracRecip = (256UL << 16) / spacing;
+    zShift = BASE_Z_SHIFT > octaves - 1 ? BASE_Z_SHIFT - (octaves - 1) : 1;
+
+    needed = (uint16_t)(((uint32_t)scale * (numPixels ? numPixels - 1 : 0) + spacing - 1) / spacing + 2);
+    rowPrev.assign(needed + LATTICE_MARGIN, 0);
+    rowNext.assign(needed + LATTICE_MARGIN, 0);
+    rowNow.assign(needed, 0);
+    values.assign(numPixels, 0);
+    primed = false;
+}
+
+uint8_t NoiseField::exact(uint16_t x, uint16_t z) const {
+    if (octaves == 1) return inoise8(x, z);
+    uint16_t sum = 0, total = 0;
+    for (uint8_t o = 0; o < octaves; o++) {
+        const uint8_t weight = 128 >> o;
+        sum += inoise8(x << o, z << o) * weight;
+        total += weight;
+    }
+    return sum / total;
+}
+
+void NoiseField::computeRow(std::vector<uint8_t>& row, uint16_t z) const {
+    uint16_t x = latticePhase + kBase * spacing;
+    for (uint16_t j = 0; j < row.size(); j++, x += spacing) {
+        row[j] = exact(x, z);
+    }
+}
+
+void NoiseField::resetLattice(uint16_t phase, uint16_t kFirst, uint16_t z) {
+    latticePhase = phase;
+    kBase = kFirst;
+    z0 = z & ~((1 << zShift) - 1);
+    computeRow(rowPrev, z0);
+    computeRow(rowNext, z0 + (1 << zShift));
+    primed = true;
+}
+
+void NoiseField::render(uint16_t origin, uint16_t z) {
+    if (numPixels == 0) return;
+    const uint16_t zStep = 1 << zShift;
+    const uint16_t phase = pixelLattice ? origin % spacing : 0;
+    const uint16_t kFirst = (origin - phase) / spacing;
+
+    if (!primed || phase != latticePhase || kFirst < kBase || kFirst + needed > kBase + rowPrev.size()) {
+        resetLattice(phase, kFirst, z);
+    } else {
+        const uint16_t dz = z - z0;
+        if (dz >= zStep && dz < 2 * zStep) {
+            // Next keyframe: the old "next" row becomes "prev"
+            rowPrev.swap(rowNext);
+            z0 += zStep;
+            computeRow(rowNext, z0 + zStep);
+        } else if (dz >= zStep) {
+            resetLattice(phase, kFirst, z); // Jumped or went backwards
+        }
+    }
+
+    // Time: blend the two keyframe rows over the samples this span needs
+    const fract8 tFrac = (uint16_t)(z - z0) << (8 - zShift);
+    const uint16_t offset = kFirst - kBase;
+    for (uint16_t j = 0; j < needed; j++) {
+        rowNow[j] = lerp8by8(rowPrev[offset + j], rowNext[offset + j], tFrac);
+    }
+
+    // Space: walk the pixels across lattice cells
+    uint16_t j = 0;
+    uint16_t rem = origin - phase - kFirst * spacing;
+    for (uint16_t i = 0; i < numPixels; i++) {
+        values[i] = lerp8by8(rowNow[j], rowNow[j + 1], ((uint32_t)rem * fracRecip) >> 16);
+        rem += scale;
+        if (rem >= spacing) { rem -= spacing; j++; }
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * Noise Field
+ * Strip-wide 1D noise with temporal coherence. Replaces per-pixel
+ * inoise8(origin + i * scale, z) loops: the noise lattice is sampled every
+ * few pixels and only at time keyframes, and the pixels in between are
+ * interpolated in space and time. At 1000 LEDs a frame typically costs a
+ * handful of inoise8 calls instead of one per pixel.
+ */
+#ifndef NOISE_FIELD_H
+#define NOISE_FIELD_H
+
+#include <FastLED.h>
+#include <vector>
+
+class NoiseField {
+public:
+    NoiseField();
+
+    // numPixels: span length. scale: noise units per pixel, the `scale` of
+    // inoise8(i * scale, z). octaves: 1 = plain inoise8; each further octave
+    // doubles the frequency at half the weight, sampled from the same
+    // gradients. Cheap to call every frame; it only resets on a change.
+    void configure(uint16_t numPixels, uint16_t scale, uint8_t octaves = 1);
+
+    // Evaluates the field for pixel i at noise x = origin + i * scale and
+    // noise time z. Moving origin or z a little per frame is what the
+    // field is built for; large jumps just trigger a fresh lattice.
+    void render(uint16_t origin, uint16_t z);
+
+    uint8_t operator[](uint16_t i) const { return values[i]; }
+    const uint8_t* data() const { return values.data(); }
+    uint16_t size() const { return numPixels; }
+
+    // Reference value straight from inoise8, with the same octave weighting
+    uint8_t exact(uint16_t x, uint16_t z) const;
+
+private:
+    void computeRow(std::vector<uint8_t>& row, uint16_t z) const;
+    void resetLattice(uint16_t phase, uint16_t kFirst, uint16_t z);
+
+    std::vector<uint8_t> rowPrev;   // Lattice samples at time z0
+    std::vector<uint8_t> rowNext;   // Lattice samples at time z0 + zStep
+    std::vector<uint8_t> rowNow;    // Samples blended to the current z
+    std::vector<uint8_t> values;    // Interpolated result per pixel
+    uint16_t numPixels;
+    uint16_t scale;
+    uint16_t spacing;       // Noise units between lattice samples
+    uint32_t fracRecip;     // (256 << 16) / spacing
+    uint16_t needed;        // Lattice samples covering the span
+    uint8_t octaves;
+    uint8_t zShift;         // zStep = 1 << zShift
+    bool pixelLattice;      // Lattice follows the pixels instead of absolute x
+    uint16_t latticePhase;  // Noise x of lattice sample 0
+    uint16_t kBase;         // Lattice index of rowPrev[0]
+    uint16_t z0;
+    bool primed;
+};
+
+#endif // NOISE_FIELD_H
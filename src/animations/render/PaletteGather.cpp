@@ -0,0 +1,139 @@
+/**
+ * Palette Gather Implementation
+ *
+ * The per-pixel math mirrors FastLED's ColorFromPalette(CRGBPalette16&)
+ * step for step so the batched results match it exactly.
+ */
+#include "PaletteGather.h"
+#include "../../config/Config.h"
+
+namespace {
+
+uint8_t scratch[MAX_LEDS];
+
+// Palette entry lookup with the 16-step linear blend toward the next entry
+inline void lookup(const CRGB* entries, uint8_t index, bool blend, uint8_t& r, uint8_t& g, uint8_t& b) {
+    const uint8_t hi4 = index >> 4;
+    const uint8_t lo4 = index & 0x0F;
+    const CRGB& a = entries[hi4];
+    r = a.r; g = a.g; b = a.b;
+    if (blend && lo4) {
+        const CRGB& n = entries[(hi4 + 1) & 0x0F]; // Entry 15 blends into entry 0
+        const uint8_t f2 = lo4 << 4;
+        const uint8_t f1 = 255 - f2;
+        r = scale8(r, f1) + scale8(n.r, f2);
+        g = scale8(g, f1) + scale8(n.g, f2);
+        b = scale8(b, f1) + scale8(n.b, f2);
+    }
+}
+
+// ColorFromPalette's brightness step; `scale` is brightness + 1, 1-255
+inline uint8_t scaleChannel(uint8_t c, uint8_t scale) {
+    if (!c) return 0;
+#if FASTLED_SCALE8_FIXED == 1
+    return scale8(c, scale);
+#else
+    return scale8(c, scale) + 1;
+#endif
+}
+
+inline CRGB applyBrightness(uint8_t r, uint8_t g, uint8_t b, uint8_t brightness) {
+    if (brightness == 255) return CRGB(r, g, b);
+    if (brightness == 0) return CRGB(0, 0, 0);
+    const uint8_t scale = brightness + 1;
+    return CRGB(scaleChannel(r, scale), scaleChannel(g, scale), scaleChannel(b, scale));
+}
+
+inline bool kernelSupports(TBlendType blendType) {
+    return blendType == NOBLEND || blendType == LINEARBLEND;
+}
+
+} // namespace
+
+namespace Render {
+
+void gatherPalette(CRGB* out, const CRGBPalette16& palette, const uint8_t* indices, uint8_t indexOffset,
+                   uint8_t brightness, uint16_t count, TBlendType blendType) {
+    if (!kernelSupports(blendType)) {
+        for (uint16_t i = 0; i < count; i++) {
+            out[i] = ColorFromPalette(palette, indices[i] + indexOffset, brightness, blendType);
+        }
+        return;
+    }
+
+    const CRGB* entries = palette.entries;
+    const bool blend = blendType != NOBLEND;
+    uint8_t r, g, b;
+    if (brightness == 255) {
+        for (uint16_t i = 0; i < count; i++) {
+            lookup(entries, indices[i] + indexOffset, blend, r, g, b);
+            out[i] = CRGB(r, g, b);
+        }
+    } else if (brightness == 0) {
+        fill_solid(out, count, CRGB::Black);
+    } else {
+        const uint8_t scale = brightness + 1;
+        for (uint16_t i = 0; i < count; i++) {
+            lookup(entries, indices[i] + indexOffset, blend, r, g, b);
+            out[i] = CRGB(scaleChannel(r, scale), scaleChannel(g, scale), scaleChannel(b, scale));
+        }
+    }
+}
+
+void gatherPalette(CRGB* out, const CRGBPalette16& palette, const uint8_t* indices, uint8_t indexOffset,
+                   const uint8_t* brightness, uint16_t count, TBlendType blendType) {
+    if (!kernelSupports(blendType)) {
+        for (uint16_t i = 0; i < count; i++) {
+            out[i] = ColorFromPalette(palette, indices[i] + indexOffset, brightness[i], blendType);
+        }
+        return;
+    }
+
+    const CRGB* entries = palette.entries;
+    const bool blend = blendType != NOBLEND;
+    uint8_t r, g, b;
+    for (uint16_t i = 0; i < count; i++) {
+        lookup(entries, indices[i] + indexOffset, blend, r, g, b);
+        out[i] = applyBrightness(r, g, b, brightness[i]);
+    }
+}
+
+uint8_t* gatherScratch() {
+    return scratch;
+}
+
+} // namespace Render
+
+// ---------------------- ExpandedPalette ----------------------
+
+bool ExpandedPalette::update(const CRGBPalette16& palette, TBlendType blend) {
+    if (expanded && blend == blendType && palette == source) return false;
+    source = palette;
+    blendType = blend;
+    expanded = true;
+    for (uint16_t i = 0; i < 256; i++) {
+        table[i] = ColorFromPalette(source, i, 255, blendType);
+    }
+    return true;
+}
+
+void ExpandedPalette::gather(CRGB* out, const uint8_t* indices, uint8_t indexOffset, uint8_t brightness, uint16_t count) const {
+    if (brightness == 255) {
+        for (uint16_t i = 0; i < count; i++) out[i] = table[(uint8_t)(indices[i] + indexOffset)];
+    } else if (brightness == 0) {
+        fill_solid(out, count, CRGB::Black);
+    } else {
+        const uint8_t scale = brightness + 1;
+        for (uint16_t i = 0; i < count; i++) {
+            const CRGB& c = table[(uint8_t)(indices[i] + indexOffset)];
+            out[i] = CRGB(scaleChannel(c.r, scale), scaleChannel(c.g, scale), scaleChannel(c.b, scale));
+        }
+    }
+}
+
+void ExpandedPalette::gather(CRGB* out, const uint8_t* indices, uint8_t indexOffset, const uint8_t* brightness, uint16_t count) const {
+    for (uint16_t i = 0; i < count; i++) {
+        const CRGB& c = table[(uint8_t)(indices[i] + indexOffset)];
+        out[i] = applyBrightness(c.r, c.g, c.b, brightness[i]);
+    }
+}
@@ -0,0 +1,56 @@
+/**
+ * Palette Gather
+ * Batched ColorFromPalette() for whole spans. The usual per-pixel loop
+ *
+ *     leds[i] = ColorFromPalette(palette, index[i] + offset, bright[i]);
+ *
+ * becomes one gatherPalette() call that keeps the palette, blend type and
+ * brightness setup out of the pixel loop. Results are bit-identical to
+ * ColorFromPalette() for NOBLEND and LINEARBLEND; any other blend type
+ * falls back to calling it per pixel.
+ */
+#ifndef PALETTE_GATHER_H
+#define PALETTE_GATHER_H
+
+#include <FastLED.h>
+
+namespace Render {
+    // out[i] = ColorFromPalette(palette, indices[i] + indexOffset, brightness, blendType)
+    void gatherPalette(CRGB* out, const CRGBPalette16& palette, const uint8_t* indices, uint8_t indexOffset,
+                       uint8_t brightness, uint16_t count, TBlendType blendType = LINEARBLEND);
+
+    // Same with a per-pixel brightness array
+    void gatherPalette(CRGB* out, const CRGBPalette16& palette, const uint8_t* indices, uint8_t indexOffset,
+                       const uint8_t* brightness, uint16_t count, TBlendType blendType = LINEARBLEND);
+
+    // MAX_LEDS bytes for staging indices or brightness before a gather.
+    // Animations render one at a time, so they all share it; contents do
+    // not survive past the gather that consumes them.
+    uint8_t* gatherScratch();
+}
+
+// ColorFromPalette() at full brightness for all 256 indices, so a gather is
+// a table lookup plus the brightness scale. Expanding costs 256 palette
+// lookups, which pays off for fixed palettes and long strips; palettes that
+// change every frame are better served by Render::gatherPalette().
+class ExpandedPalette {
+public:
+    ExpandedPalette() : blendType(LINEARBLEND), expanded(false) {}
+
+    // Re-expands only when the palette or blend type differ from the last
+    // call; returns true if it did
+    bool update(const CRGBPalette16& palette, TBlendType blend = LINEARBLEND);
+
+    void gather(CRGB* out, const uint8_t* indices, uint8_t indexOffset, uint8_t brightness, uint16_t count) const;
+    void gather(CRGB* out, const uint8_t* indices, uint8_t indexOffset, const uint8_t* brightness, uint16_t count) const;
+
+    const CRGB& operator[](uint8_t index) const { return table[index]; }
+
+private:
+    CRGB table[256];
+    CRGBPalette16 source;
+    TBlendType blendType;
+    bool expanded;
+};
+
+#endif // PALETTE_GATHER_H
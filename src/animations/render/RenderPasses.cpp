@@ -0,0 +1,64 @@
+/**
+ * Render Passes Implementation
+ */
+#include "RenderPasses.h"
+
+namespace Render {
+
+uint16_t uniqueLength(uint16_t numLeds, Symmetry mode) {
+    if (mode == Symmetry::NONE || numLeds < 2) return numLeds;
+    return (numLeds + 1) / 2;
+}
+
+void replicateSymmetry(CRGB* leds, uint16_t uniqueLen, uint16_t numLeds, Symmetry mode) {
+    if (!leds || mode == Symmetry::NONE || uniqueLen == 0 || uniqueLen >= numLeds) return;
+
+    // Exact mirror around the centre, also for odd lengths
+    for (uint16_t i = uniqueLen; i < numLeds; i++) {
+        leds[i] = leds[numLeds - 1 - i];
+    }
+}
+
+void interpolateFrames(CRGB* out, const CRGB* from, const CRGB* to, uint16_t numLeds, fract8 frac) {
+    uint8_t* dst = reinterpret_cast<uint8_t*>(out);
+    const uint8_t* a = reinterpret_cast<const uint8_t*>(from);
+    const uint8_t* b = reinterpret_cast<const uint8_t*>(to);
+    const uint16_t bytes = numLeds * 3;
+    if (frac == 0) {
+        memcpy(dst, a, bytes);
+        return;
+    }
+    for (uint16_t i = 0; i < bytes; i++) {
+        dst[i] = a[i] + (((int16_t)b[i] - a[i]) * frac >> 8);
+    }
+}
+
+void upscaleLinear(CRGB* leds, uint16_t numLeds, uint8_t stride) {
+    if (!leds || stride <= 1 || numLeds < 3) return;
+
+    // Blend weights for a full-width gap, computed once per call
+    fract8 weights[256];
+    for (uint8_t k = 1; k < stride; k++) {
+        weights[k] = (uint16_t)k * 256 / stride;
+    }
+
+    const uint16_t last = numLeds - 1;
+    for (uint16_t a = 0; a < last; a += stride) {
+        const uint16_t b = (a + stride < last) ? a + stride : last;
+        const uint16_t gap = b - a;
+        const CRGB from = leds[a];
+        const CRGB to = leds[b];
+        if (gap == stride) {
+            for (uint8_t k = 1; k < gap; k++) {
+                leds[a + k] = from.lerp8(to, weights[k]);
+            }
+        } else {
+            // Tail segment ends on the last pixel, not on a stride boundary
+            for (uint8_t k = 1; k < gap; k++) {
+                leds[a + k] = from.lerp8(to, (uint16_t)k * 256 / gap);
+            }
+        }
+    }
+}
+
+} // namespace Render
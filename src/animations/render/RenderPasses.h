@@ -0,0 +1,32 @@
+/**
+ * Render Passes
+ * Output-stage helpers shared by all animations (upscaling, replication, ...)
+ */
+#ifndef RENDER_PASSES_H
+#define RENDER_PASSES_H
+
+#include <FastLED.h>
+
+namespace Render {
+    // Layouts an animation can declare so only its unique segment is rendered
+    enum class Symmetry : uint8_t {
+        NONE,
+        MIRROR  // second half is the first half reversed
+    };
+
+    // Length of the segment that has to be rendered for a given layout
+    uint16_t uniqueLength(uint16_t numLeds, Symmetry mode);
+
+    // Copies leds[0, uniqueLen) over the rest of the strip according to the layout
+    void replicateSymmetry(CRGB* leds, uint16_t uniqueLen, uint16_t numLeds, Symmetry mode);
+
+    // out = from + (to - from) * frac / 256 for every channel of numLeds pixels
+    void interpolateFrames(CRGB* out, const CRGB* from, const CRGB* to, uint16_t numLeds, fract8 frac);
+
+    // Fills the gaps of a sub-sampled frame. Pixels at multiples of `stride`
+    // and the last pixel must already hold computed colors; everything in
+    // between is linearly interpolated from its two neighbouring anchors.
+    void upscaleLinear(CRGB* leds, uint16_t numLeds, uint8_t stride);
+}
+
+#endif // RENDER_PASSES_H
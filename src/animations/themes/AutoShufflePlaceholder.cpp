@@ -7,7 +7,7 @@ class AutoShuffleAnimation : public Animation {
 public:
     AutoShuffleAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "R Shuffle") {}
-    void update() override {}
+    void update(const FrameContext&) override {}
 };
 static Registrar<AutoShuffleAnimation> AutoShuffleAnimationRegistrar("R Shuffle");
 
@@ -16,7 +16,7 @@ class AutoShuffleAnimation1 : public Animation {
 public:
     AutoShuffleAnimation1(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "10s Shuffle") {}
-    void update() override {}
+    void update(const FrameContext&) override {}
 };
 static Registrar<AutoShuffleAnimation1> AutoShuffleAnimation1Registrar("10s shuffle");
 
@@ -26,7 +26,7 @@ class AutoShuffleAnimation2 : public Animation {
 public:
     AutoShuffleAnimation2(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "10s Shuffle") {}
-    void update() override {}
+    void update(const FrameContext&) override {}
 };
 static Registrar<AutoShuffleAnimation2> AutoShuffleAnimation2Registrar("10s shuffle");
 
@@ -35,6 +35,6 @@ class AutoShuffleAnimation3 : public Animation {
 public:
     AutoShuffleAnimation3(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Shuffle") {}
-    void update() override {}
+    void update(const FrameContext&) override {}
 };
 static Registrar<AutoShuffleAnimation3> AutoShuffleAnimation3Registrar("5m shuffle");
@@ -10,26 +10,22 @@ private:
     uint8_t gHue;
     uint16_t t;
     uint32_t seed;
-    CRGBPalette16 currentPalette;
-    CRGBPalette16 altPalette;
+    PaletteBlend currentPalette; // Drifts toward the mood's palette
     uint8_t mood;
     uint8_t modeStep;
-    unsigned long lastMoodSwitch;
-    unsigned long lastChaosEvent;
+    RateAccumulator hueStep;
+    RateAccumulator fadeStep; // Fade passes, one per nominal frame
+    NoiseField noise;
+    TimerWheel<CosmicBeastOfManyMoods> timers;
 
-    void blendPalettes() {
-        nblendPaletteTowardPalette(currentPalette, altPalette, 5);
-    }
-
-    void chooseNewMood() {
+    void chooseNewMood(const FrameContext&) {
         mood = random8(4);
         switch (mood) {
-            case 0: altPalette = PartyColors_p; break;
-            case 1: altPalette = ForestColors_p; break;
-            case 2: altPalette = OceanColors_p; break;
-            case 3: altPalette = CRGBPalette16(CHSV(random8(), 200, 255), CHSV(random8(), 255, 255), CHSV(random8(), 255, 200), CHSV(random8(), 150, 255)); break;
+            case 0: currentPalette.setTarget(PartyColors_p); break;
+            case 1: currentPalette.setTarget(ForestColors_p); break;
+            case 2: currentPalette.setTarget(OceanColors_p); break;
+            case 3: currentPalette.setTarget(CRGBPalette16(CHSV(random8(), 200, 255), CHSV(random8(), 255, 255), CHSV(random8(), 255, 200), CHSV(random8(), 150, 255))); break;
         }
-        lastMoodSwitch = millis();
     }
 
     void glitterStorm(uint8_t intensity) {
@@ -38,29 +34,25 @@ private:
         }
     }
 
-    void chaosEvent() {
+    void chaosEvent(const FrameContext& frame) {
         switch (random8(4)) {
-            case 0: fill_rainbow(leds, numLeds, gHue); break;
-            case 1: for (int i = 0; i < numLeds; i++) leds[i] = CHSV(gHue + i * 5, 255, beatsin8(12, 120, 255)); break;
+            case 0: Render::fillRainbow(leds, numLeds, gHue); break;
+            case 1: Render::fillHue(leds, numLeds, gHue, 5, 255, frame.beatsin8(12, 120, 255)); break;
             case 2: glitterStorm(30); break;
             case 3: fill_solid(leds, numLeds, CRGB::Purple); break;
         }
-        lastChaosEvent = millis();
     }
 
-    void noiseLayer() {
+    void noiseLayer(uint32_t nowMs) {
+        noise.render(0, nowMs / 4 + seed);
         for (uint16_t i = 0; i < numLeds; i++) {
-            uint8_t index = inoise8(i * 10, millis() / 4 + seed);
-            leds[i] += ColorFromPalette(currentPalette, index + gHue, 128);
+            leds[i] += ColorFromPalette(currentPalette, noise[i] + gHue, 128);
         }
     }
 
-    void pulseLayer() {
-        uint8_t wave = beatsin8(10, 0, 255);
-        for (uint16_t i = 0; i < numLeds; i++) {
-            if (i % (wave / 32 + 1) == 0)
-                leds[i] += CHSV(gHue + i * 3, 255, wave);
-        }
+    void pulseLayer(const FrameContext& frame) {
+        uint8_t wave = frame.beatsin8(10, 0, 255);
+        Render::addHue(leds, numLeds, gHue, 3, 255, wave, wave / 32 + 1);
     }
 
     void sparkleLayer() {
@@ -68,32 +60,27 @@ private:
     }
 
 public:
-    CosmicBeastOfManyMoods(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Cosmic Beast of Many Moods"), gHue(0), t(0), seed(random16()), mood(0), modeStep(0), lastMoodSwitch(0), lastChaosEvent(0) {
-        currentPalette = RainbowColors_p;
-        altPalette = LavaColors_p;
+    CosmicBeastOfManyMoods(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Cosmic Beast of Many Moods"), gHue(0), t(0), seed(random16()), currentPalette(RainbowColors_p), mood(0), modeStep(0) {
+        currentPalette.setTarget(LavaColors_p);
+        currentPalette.setRate(5, NOMINAL_FRAME_MS);
+        noise.configure(numLeds, 10);
+        timers.every(20000, &CosmicBeastOfManyMoods::chooseNewMood);
+        // The old per-frame random16(5000, 10000) test fired ~0.4s past 5s
+        timers.everyRandom(5000, 5800, &CosmicBeastOfManyMoods::chaosEvent);
     }
 
-    void update() override {
-        EVERY_N_MILLISECONDS(50) {
-            gHue++;
-            t++;
-        }
+    void update(const FrameContext& frame) override {
+        const uint32_t ticks = hueStep.advance(frame.deltaMs, 1, 50);
+        gHue += ticks;
+        t += ticks;
 
-        blendPalettes();
-
-        if (millis() - lastMoodSwitch > 20000) {
-            chooseNewMood();
-        }
-
-        if (millis() - lastChaosEvent > random16(5000, 10000)) {
-            chaosEvent();
-        }
+        timers.tick(*this, frame); // Mood swaps and chaos events
 
-        fadeToBlackBy(leds, numLeds, 20);
+        for (uint32_t n = fadeStep.perFrame(frame.deltaMs, 1); n; n--) fadeToBlackBy(leds, numLeds, 20);
 
         // Core effect layering
-        noiseLayer();
-        pulseLayer();
+        noiseLayer(frame.nowMs);
+        pulseLayer(frame);
         sparkleLayer();
 
         if (random8() < 10) glitterStorm(5);
@@ -107,51 +94,56 @@ class TomorrowlandStageAnimation : public Animation {
 private:
     uint8_t gHue = 0;
     uint16_t noiseOffset = 0;
-    uint8_t laserPos = 0;
-    bool laserActive = false;
     uint8_t pyroChance = 5; // % chance per frame for pyro flash
-    CRGBPalette16 festivalPalette = CRGBPalette16(
-        CRGB::Purple, CRGB::HotPink, CRGB::Cyan, CRGB::Lime,
-        CRGB::BlueViolet, CRGB::Magenta, CRGB::Turquoise, CRGB::GreenYellow,
-        CRGB::Indigo, CRGB::DeepPink, CRGB::SkyBlue, CRGB::Chartreuse,
-        CRGB::DarkViolet, CRGB::Fuchsia, CRGB::DodgerBlue, CRGB::SpringGreen
-    );
-public:TomorrowlandStageAnimation(CRGB* ledArray, uint16_t numLeds) : Animation(ledArray, numLeds, "Tomorrowland Stage") {}
-    void update() override {
-        EVERY_N_MILLISECONDS(20) { gHue++; noiseOffset += 2; } // Smooth shift
-        fadeToBlackBy(leds, numLeds, 15); // Trails and fade
+    RateAccumulator shiftStep;
+    RateAccumulator fadeStep; // Fade passes, one per nominal frame
+    NoiseField waves;
+    ParticlePool lasers{2};
+    ParticlePool pyro{8};
+    ExpandedPalette festival;
+    TimerWheel<TomorrowlandStageAnimation> timers;
+    uint32_t lastPyroFade = 0;
+public:TomorrowlandStageAnimation(CRGB* ledArray, uint16_t numLeds) : Animation(ledArray, numLeds, "Tomorrowland Stage") {
+        festival.update(Palettes::Festival_p);
+        // Symmetry patterns: Mirror effect for stage-like feel, only the first half is rendered
+        setSymmetry(Render::Symmetry::MIRROR);
+        waves.configure(numLeds, 15);
+        lasers.setBounds(0, this->numLeds, ParticlePool::Edge::KILL);
+        pyro.setFadeOut(true);
+    }
+    void update(const FrameContext& frame) override {
+        timers.tick(*this, frame);
+        const uint32_t shift = shiftStep.advance(frame.deltaMs, 1, 20); // Smooth shift
+        gHue += shift; noiseOffset += 2 * shift;
+        for (uint32_t n = fadeStep.perFrame(frame.deltaMs, 1); n; n--) fadeToBlackBy(leds, numLeds, 15); // Trails and fade
 
         // Base LED waves (noise for organic movement)
+        waves.render(noiseOffset, gHue * 2);
+        uint8_t* bright = Render::gatherScratch();
         for (int i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * 15 + noiseOffset, gHue * 2);
-            uint8_t bright = sin8(noise) / 2 + 100; // Pulsing brightness
-            leds[i] = ColorFromPalette(festivalPalette, noise + gHue, bright, LINEARBLEND);
-        }
-
-        // Laser beams: Fast moving white lines with fade
-        if (!laserActive && random8() < 10) { laserActive = true; laserPos = 0; }
-        if (laserActive) {
-            if (laserPos < numLeds) {
-                leds[laserPos] = CRGB::White; // Bright laser
-                if (laserPos > 0) leds[laserPos - 1].fadeToBlackBy(100); // Short trail
-                laserPos += 3; // Speed
-            } else {
-                laserActive = false;
-            }
+            bright[i] = sin8(waves[i]) / 2 + 100; // Pulsing brightness
+        }
+        festival.gather(leds, waves.data(), gHue, bright, numLeds);
+
+        // Laser beams: Fast moving white lines, leaving the stage at the far end
+        if (lasers.count() == 0 && random8() < 10) {
+            lasers.spawn(ParticlePool::pixelCenter(0), ParticlePool::pixelsPerFrame(3), CRGB::White, 0, 2 * 256);
+        }
+        lasers.update(frame.deltaMs);
+        lasers.render(leds, numLeds);
+        for (uint16_t i = 0; i < lasers.count(); i++) {
+            const int16_t behind = ((lasers.position(i) - ParticlePool::pixels(1)) >> 16) - 1; // Just behind the 2-pixel beam
+            if (behind >= 0 && behind < numLeds) leds[behind].fadeToBlackBy(100); // Short trail
         }
 
         // Pyro flashes: Random bright white bursts fading quickly
         if (random8() < pyroChance) {
-            uint16_t pos = random16(numLeds);
-            leds[pos] = CRGB::White;
+            pyro.spawn(ParticlePool::pixelCenter(random16(numLeds)), 0, CRGB::White, 150);
             addGlitter(50); // Extra sparkles during pyro
-            EVERY_N_MILLISECONDS(50) { fadeToBlackBy(leds, numLeds, 150); } // Quick fade
-        }
-
-        // Symmetry patterns: Mirror effect for stage-like feel
-        for (int i = 0; i < numLeds / 2; i++) {
-            leds[numLeds - 1 - i] = leds[i]; // Mirror
+            if (timers.throttle(lastPyroFade, 50)) fadeToBlackBy(leds, numLeds, 150); // Quick fade
         }
+        pyro.update(frame.deltaMs);
+        pyro.render(leds, numLeds);
     }
 };
 static Registrar<TomorrowlandStageAnimation> tomorrowlandStageRegistrator("Tomorrowland Stage");
@@ -160,15 +152,18 @@ class GlitchedCyberAnimation : public Animation {
 private:
   uint8_t gHue = 0;
   uint8_t glitchDensity = 20;
+  RateAccumulator hueStep;
   CRGBPalette16 neonPalette = CRGBPalette16(CRGB::HotPink, CRGB::Cyan, CRGB::Purple, CRGB::Lime);
 public:
 GlitchedCyberAnimation(CRGB* ledArray, uint16_t numLeds) : Animation(ledArray, numLeds, "Glitched Cyber") {}
-  void update() override {
-    EVERY_N_MILLISECONDS(50) { gHue++; }
-    fadeToBlackBy(leds, numLeds, 30); // Quick fade for motion
+  void update(const FrameContext& frame) override {
+    gHue += hueStep.advance(frame.deltaMs, 1, 50);
     fill_solid(leds, numLeds, CRGB::Black); // Base dark
+    // One die per pixel, rolled as a batch; only the hits roll again
+    uint8_t* dice = Render::gatherScratch();
+    RandomStream::fill(dice, numLeds);
     for (int i = 0; i < numLeds; i++) {
-      if (random8() < glitchDensity) {
+      if (dice[i] < glitchDensity) {
         uint8_t glitchType = random8(3);
         if (glitchType == 0) { // Pixel glitch
           leds[i] = ColorFromPalette(neonPalette, gHue + random8(64), 255);
@@ -192,14 +187,16 @@ private:
     uint8_t gHue = 0; // Global hue shift for base colors
     uint8_t chaosFactor = 0; // Builds over time for more randomness
     uint8_t currentMood = 0; // 0: Fiery Playa, 1: Psychedelic Dust, 2: Mystic Hug, 3: Wild Carnival
-    unsigned long lastMoodChange = 0;
-    unsigned long lastThunder = 0;
-    unsigned long lastHug = 0;
     uint16_t dustNoiseOffset = 0;
-    uint8_t artCarPos = 0;
-    uint8_t artCarSpeed = 2;
+    uint32_t lastThunderFade = 0;
     bool thunderActive = false;
     bool hugActive = false;
+    RateAccumulator dustStep;
+    RateAccumulator hueStep;
+    NoiseField dust;
+    ParticlePool artCars{8};
+    HeatField playaFire; // The Fiery Playa mood burns instead of drifting dust
+    TimerWheel<PlayaChaosCarnivalAnimation> timers; // Mood, hug and thunder schedule
     CRGBPalette16 moodPalettes[4] = {
         CRGBPalette16(CRGB::Black, CRGB::Red, CRGB::Orange, CRGB::Yellow), // Fiery
         CRGBPalette16(CRGB::Black, CRGB::Purple, CRGB::Blue, CRGB::Indigo), // Psychedelic
@@ -208,42 +205,63 @@ private:
     };
 
     // Internal method: Apply base dust storm noise layer
-    void applyDustStorm() {
-        dustNoiseOffset += random8(1, 3); // Random speed variation
+    void applyDustStorm(uint32_t deltaMs) {
+        if (currentMood == 0) {
+            playaFire.setSparking(100 + chaosFactor * 2); // Wilder fire as chaos builds
+            playaFire.update(deltaMs);
+            playaFire.render(leds, moodPalettes[0]);
+            return;
+        }
+        dustNoiseOffset += dustStep.perFrame(deltaMs, random8(1, 3)); // Random speed variation
+        dust.configure(numLeds, 10 + chaosFactor / 10); // Grain tightens as chaos builds
+        dust.render(0, dustNoiseOffset);
+        uint8_t* bright = Render::gatherScratch();
         for (int i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * (10 + chaosFactor / 10), dustNoiseOffset);
-            uint8_t bright = sin8(noise) / 2 + 50; // Medium brightness
-            leds[i] = ColorFromPalette(moodPalettes[currentMood], noise + gHue, bright, LINEARBLEND);
+            bright[i] = sin8(dust[i]) / 2 + 50; // Medium brightness
         }
+        Render::gatherPalette(leds, moodPalettes[currentMood], dust.data(), gHue, bright, numLeds);
+    }
+
+    // The old single car stepped 1-3 pixels on each of the 3 + chaos/10 calls
+    // a frame that passed the (20 + chaos)/256 roll; cars move at that rate
+    int32_t artCarVelocity() {
+        const uint16_t stepsQ8 = (3 + chaosFactor / 10) * (20 + chaosFactor); // Steps per frame, Q8
+        return ParticlePool::pixelsPerFrame(random8(1, 4)) / 256 * stepsQ8;
     }
 
     // Internal method: Chase "mutant vehicles" with trails
     void runArtCars() {
-        if (random8() < 20 + chaosFactor) { // More cars as chaos increases
-            artCarPos = (artCarPos + artCarSpeed) % numLeds;
-            leds[artCarPos] = CHSV(gHue + 128, 255, 200); // Bright opposing color
-            for (int trail = 1; trail < 5; trail++) { // Trail loop
-                if (artCarPos >= trail) {
-                    leds[artCarPos - trail].fadeToBlackBy(50 * trail); // Fading trail
-                }
+        if (random8() < 20 + chaosFactor) {
+            if (artCars.count() < 1 + chaosFactor / 10) { // More cars as chaos increases
+                artCars.spawn(ParticlePool::pixelCenter(random16(numLeds)), artCarVelocity(),
+                              CHSV(gHue + 128, 255, 200), 0, 384); // Bright opposing color
+            } else {
+                artCars.setVelocity(random8(artCars.count()), artCarVelocity()); // Random speed change
+            }
+        }
+    }
+
+    // Dark trail behind each car, cut into the background since the
+    // background layer repaints the whole strip every frame
+    void drawArtCarTrails() {
+        for (uint16_t c = 0; c < artCars.count(); c++) {
+            const int16_t head = artCars.position(c) >> 16;
+            for (int16_t trail = 1; trail < 5; trail++) { // Trail loop
+                leds[(head - trail + numLeds) % numLeds].fadeToBlackBy(50 * trail); // Fading trail
             }
-            artCarSpeed = random8(1, 4); // Random speed change
         }
     }
 
     // Internal method: Trigger "hug bursts" - warm pulses
     void triggerHugBurst() {
-        if (hugActive) {
-            for (int i = 0; i < numLeds; i++) {
-                leds[i].r = min(255, leds[i].r + random8(50, 100)); // Warm red/orange boost
-                leds[i].fadeLightBy(200 - chaosFactor); // Fade based on chaos
-            }
-            if (random8() < 10) hugActive = false; // Random end
-        } else if (millis() - lastHug > random16(10000, 30000)) { // Random trigger
-            hugActive = true;
-            lastHug = millis();
+        if (!hugActive) return;
+        for (int i = 0; i < numLeds; i++) {
+            leds[i].r = min(255, leds[i].r + random8(50, 100)); // Warm red/orange boost
+            leds[i].fadeLightBy(200 - chaosFactor); // Fade based on chaos
         }
+        if (random8() < 10) hugActive = false; // Random end
     }
+    void startHug(const FrameContext&) { hugActive = true; }
 
     // Internal method: Sprinkle "fairy dust" sparkles
     void sprinkleFairyDust() {
@@ -259,42 +277,50 @@ private:
 
     // Internal method: Occasional "thunderclap" flash
     void thunderClap() {
-        if (thunderActive) {
-            fill_solid(leds, numLeds, CRGB::White); // Bright flash
-            EVERY_N_MILLISECONDS(50) { fadeToBlackBy(leds, numLeds, 200); } // Quick fade
-            if (random8() < 20) thunderActive = false;
-        } else if (millis() - lastThunder > random16(20000, 60000)) {
-            thunderActive = true;
-            lastThunder = millis();
-        }
+        if (!thunderActive) return;
+        fill_solid(leds, numLeds, CRGB::White); // Bright flash
+        if (timers.throttle(lastThunderFade, 50)) fadeToBlackBy(leds, numLeds, 200); // Quick fade
+        if (random8() < 20) thunderActive = false;
     }
+    void startThunder(const FrameContext&) { thunderActive = true; }
 
     // Internal method: Morph moods and chaos
-    void morphMood() {
-        // WARNING: random16(90000) overflows uint16_t, max value is 65535. Consider using a lower max.
-        if (millis() - lastMoodChange > random16(30000, 60000)) { // Random mood shift, reduced max to avoid overflow warning
-            currentMood = random8(4);
-            chaosFactor = min(50, chaosFactor + random8(5, 10)); // Build chaos
-            gHue += random8(64, 128); // Hue jump
-            lastMoodChange = millis();
-            randomSeed(millis() + chaosFactor); // Reseed for more randomness
-        }
+    void morphMood(const FrameContext&) {
+        currentMood = random8(4);
+        chaosFactor = min(50, chaosFactor + random8(5, 10)); // Build chaos
+        gHue += random8(64, 128); // Hue jump
     }
 
 public:
 PlayaChaosCarnivalAnimation(CRGB* ledArray, uint16_t numLeds) : Animation(ledArray, numLeds, "Playa Chaos Carnival") {
-        randomSeed(millis()); // Initial seed for randomness
-    }
-    void update() override {
-        fadeToBlackBy(leds, numLeds, 10 + chaosFactor / 5); // Base fade, increases with chaos
+        artCars.setBounds(0, numLeds, ParticlePool::Edge::WRAP);
+
+        // Two burn sites, each flaring both ways
+        playaFire.configure(numLeds);
+        const uint16_t sites[] = {(uint16_t)(numLeds / 4), (uint16_t)(numLeds * 3 / 4)};
+        for (uint16_t site : sites) {
+            playaFire.addSource(site, numLeds / 4 + 1);
+            playaFire.addSource(site, numLeds / 4 + 1, true);
+        }
+        playaFire.setCooling(70);
 
+        // The old code drew a fresh random bound every frame, so each event
+        // fired within a second or two of its minimum; keep that cadence
+        timers.everyRandom(30000, 32000, &PlayaChaosCarnivalAnimation::morphMood);
+        timers.everyRandom(10000, 11500, &PlayaChaosCarnivalAnimation::startHug);
+        timers.everyRandom(20000, 22000, &PlayaChaosCarnivalAnimation::startThunder);
+    }
+    void update(const FrameContext& frame) override {
         // Core loop: Apply layers with side effects
-        morphMood(); // Check for mood/chaos changes
-        applyDustStorm(); // Background noise
+        timers.tick(*this, frame); // Mood/chaos changes, hug and thunder starts
+        applyDustStorm(frame.deltaMs); // Background noise or fire, repainting every pixel
         for (uint8_t loop = 0; loop < 3 + chaosFactor / 10; loop++) { // Overengineered multi-loop for density
             runArtCars(); // Chasing vehicles
             sprinkleFairyDust(); // Sparkles
         }
+        artCars.update(frame.deltaMs);
+        artCars.render(leds, numLeds); // Over the dust or fire
+        drawArtCarTrails();
         triggerHugBurst(); // Pulses
         thunderClap(); // Flashes
 
@@ -303,7 +329,7 @@ PlayaChaosCarnivalAnimation(CRGB* ledArray, uint16_t numLeds) : Animation(ledArr
             nblend(leds[random16(numLeds)], CRGB::Black, random8(50)); // Random dim spot
         }
 
-        EVERY_N_MILLISECONDS(50) { gHue++; } // Slow hue drift
+        gHue += hueStep.advance(frame.deltaMs, 1, 50); // Slow hue drift
     }
 };
 static Registrar<PlayaChaosCarnivalAnimation> playaChaosCarnivalRegistrator("Playa Chaos Carnival");
@@ -313,28 +339,33 @@ private:
     uint8_t gHue;
     uint16_t t;
     uint32_t wizardSeed;
-    CRGBPalette16 wizardPalette;
-    CRGBPalette16 lizardPalette;
+    SharedPalette wizardPalette;
+    SharedPalette lizardPalette;
     bool isWizardPhase;
-    unsigned long lastPhaseSwitch;
+    RateAccumulator hueStep;
+    RateAccumulator fadeStep; // Fade passes, one per nominal frame
+    NoiseField spellNoise;
+    TimerWheel<SpaceWizardsAndLizards> timers;
 
-    void switchPhase() {
+    void switchPhase(const FrameContext&) {
         isWizardPhase = !isWizardPhase;
-        lastPhaseSwitch = millis();
         wizardSeed = random16();
     }
 
-    void castWizardSpell() {
+    void castWizardSpell(uint32_t nowMs) {
+        spellNoise.render(0, nowMs / 3 + wizardSeed);
+        uint8_t* brightness = Render::gatherScratch();
+        for (uint16_t i = 0; i < numLeds; i++) {
+            brightness[i] = sin8(spellNoise[i] + gHue);
+        }
+        Render::gatherPalette(leds, wizardPalette, spellNoise.data(), 0, brightness, numLeds);
         for (uint16_t i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * 15, millis() / 3 + wizardSeed);
-            uint8_t brightness = sin8(noise + gHue);
-            leds[i] = ColorFromPalette(wizardPalette, noise, brightness);
             if (random8() < 8) leds[i] += CRGB::White;
         }
     }
 
-    void summonLizardAura() {
-        fadeToBlackBy(leds, numLeds, 25);
+    void summonLizardAura(const FrameContext& frame) {
+        for (uint32_t n = fadeStep.perFrame(frame.deltaMs, 1); n; n--) fadeToBlackBy(leds, numLeds, 25);
         for (uint16_t i = 0; i < numLeds; i++) {
             if (i % 7 == 0) {
                 uint8_t index = (gHue + i * 2 + t) % 255;
@@ -342,41 +373,32 @@ private:
             }
         }
         if (random8() < 30) {
-            uint16_t burstPos = beatsin16(5, 0, numLeds - 1);
+            uint16_t burstPos = frame.beatsin16(5, 0, numLeds - 1);
             leds[burstPos] += CRGB::Green;
             leds[(burstPos + 1) % numLeds] += CRGB::Yellow;
         }
     }
 
 public:
-    SpaceWizardsAndLizards(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Space Wizards & Lizards"), gHue(0), t(0), wizardSeed(random16()), isWizardPhase(true), lastPhaseSwitch(0) {
-        wizardPalette = CRGBPalette16(
-            CHSV(180, 255, 255), CHSV(200, 255, 200), CHSV(160, 255, 255), CHSV(180, 200, 255),
-            CHSV(190, 255, 255), CHSV(170, 255, 180), CHSV(210, 200, 255), CHSV(160, 180, 200),
-            CHSV(180, 255, 255), CHSV(200, 255, 200), CHSV(160, 255, 255), CHSV(180, 200, 255),
-            CHSV(190, 255, 255), CHSV(170, 255, 180), CHSV(210, 200, 255), CHSV(160, 180, 200));
+    SpaceWizardsAndLizards(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Space Wizards & Lizards"), gHue(0), t(0), wizardSeed(random16()), isWizardPhase(true) {
+        wizardPalette = SharedPalette::fromHsv(Palettes::WIZARD);
+        lizardPalette = SharedPalette::fromHsv(Palettes::LIZARD);
 
-        lizardPalette = CRGBPalette16(
-            CHSV(85, 255, 255), CHSV(100, 200, 255), CHSV(120, 255, 200), CHSV(90, 255, 180),
-            CHSV(110, 255, 255), CHSV(100, 255, 255), CHSV(130, 255, 180), CHSV(85, 180, 200),
-            CHSV(85, 255, 255), CHSV(100, 200, 255), CHSV(120, 255, 200), CHSV(90, 255, 180),
-            CHSV(110, 255, 255), CHSV(100, 255, 255), CHSV(130, 255, 180), CHSV(85, 180, 200));
+        spellNoise.configure(numLeds, 15);
+        timers.every(15000, &SpaceWizardsAndLizards::switchPhase);
     }
 
-    void update() override {
-        EVERY_N_MILLISECONDS(40) {
-            gHue++;
-            t++;
-        }
+    void update(const FrameContext& frame) override {
+        const uint32_t ticks = hueStep.advance(frame.deltaMs, 1, 40);
+        gHue += ticks;
+        t += ticks;
 
-        if (millis() - lastPhaseSwitch > 15000) {
-            switchPhase();
-        }
+        timers.tick(*this, frame);
 
         if (isWizardPhase) {
-            castWizardSpell();
+            castWizardSpell(frame.nowMs);
         } else {
-            summonLizardAura();
+            summonLizardAura(frame);
         }
     }
 };
@@ -384,15 +406,20 @@ public:
 static Registrar<SpaceWizardsAndLizards> spaceWizardsAndLizardsRegistrator("Space Wizards Lizards");
 
 class JuggleAnimation : public Animation {
+  private:
+    CometTrails dots;
   public:
-    JuggleAnimation(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Juggle") {}
-    void update() override {
-        fadeToBlackBy(leds, numLeds, 20);
+    JuggleAnimation(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Juggle") {
+        dots.configure(numLeds, 20);
+    }
+    void update(const FrameContext& frame) override {
+        dots.advance(frame.deltaMs);
         byte dothue = 0;
         for(int i = 0; i < 8; i++) {
-            leds[beatsin16(i+7, 0, numLeds-1)] |= CHSV(dothue, 200, brightness);
+            dots.moveTo(i, CometTrails::sweep(frame.beatsin16(i+7), numLeds), CHSV(dothue, 200, brightness));
             dothue += 32;
         }
+        dots.render(leds);
     }
 };
 static Registrar<JuggleAnimation> juggleRegistrator("Juggle");
@@ -400,13 +427,17 @@ static Registrar<JuggleAnimation> juggleRegistrator("Juggle");
 class SinelonAnimation : public Animation {
   private:
     uint8_t gHue;
+    RateAccumulator hueStep;
+    CometTrails comet;
   public:
-    SinelonAnimation(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Sinelon"), gHue(0) {}
-    void update() override {
-        fadeToBlackBy(leds, numLeds, 20);
-        int pos = beatsin16(13, 0, numLeds-1);
-        leds[pos] += CHSV(gHue, 255, brightness);
-        EVERY_N_MILLISECONDS(20) { gHue++; }
+    SinelonAnimation(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Sinelon"), gHue(0) {
+        comet.configure(numLeds, 20);
+    }
+    void update(const FrameContext& frame) override {
+        comet.advance(frame.deltaMs);
+        comet.moveTo(0, CometTrails::sweep(frame.beatsin16(13), numLeds), CHSV(gHue, 255, brightness));
+        comet.render(leds);
+        gHue += hueStep.advance(frame.deltaMs, 1, 20);
     }
 };
 static Registrar<SinelonAnimation> sinelonRegistrator("Sinelon");
@@ -414,19 +445,20 @@ static Registrar<SinelonAnimation> sinelonRegistrator("Sinelon");
 class FireTribeWonderland : public Animation {
 private:
     uint8_t gHue;
-    uint16_t t;
-    CRGBPalette16 softFlamePalette;
-    CRGBPalette16 sunsetGlowPalette;
-    CRGBPalette16 warmDreamPalette;
+    SharedPalette softFlamePalette;
+    SharedPalette sunsetGlowPalette;
+    SharedPalette warmDreamPalette;
     uint8_t morphStage;
     unsigned long lastMorph;
+    RateAccumulator hueStep;
+    HeatField flames;
 
-    void morphPalette() {
+    void morphPalette(uint32_t nowMs) {
         morphStage = (morphStage + 1) % 3;
-        lastMorph = millis();
+        lastMorph = nowMs;
     }
 
-    CRGBPalette16 getCurrentPalette() {
+    const CRGBPalette16& getCurrentPalette() const {
         switch (morphStage) {
             case 0: return softFlamePalette;
             case 1: return sunsetGlowPalette;
@@ -434,16 +466,16 @@ private:
         }
     }
 
-    void drawLayeredWaves(CRGBPalette16 palette) {
-        for (uint16_t i = 0; i < numLeds; i++) {
-            uint8_t offset = sin8(i * 3 + t / 2);
-            uint8_t index = inoise8(i * 12, t + offset * 2);
-            leds[i] = ColorFromPalette(palette, index + gHue, 200, LINEARBLEND);
-        }
+    // Tribe fires burning in from both ends of the strip; the palettes have
+    // no black end, so heat also sets the brightness
+    void drawFlames(const FrameContext& frame, const CRGBPalette16& palette) {
+        flames.setSparking(frame.beatsin8(4, 90, 150)); // Breathes with the pulse
+        flames.update(frame.deltaMs);
+        flames.render(leds, palette, gHue, true);
     }
 
-    void overlayPulse() {
-        uint8_t pulse = beatsin8(4, 40, 120);
+    void overlayPulse(const FrameContext& frame) {
+        uint8_t pulse = frame.beatsin8(4, 40, 120);
         for (uint16_t i = 0; i < numLeds; i++) {
             leds[i].fadeLightBy(255 - pulse);
         }
@@ -456,42 +488,28 @@ private:
     }
 
 public:
-    FireTribeWonderland(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Fire Tribe Wonderland"), gHue(0), t(0), morphStage(0), lastMorph(0) {
-
-        softFlamePalette = CRGBPalette16(
-            CHSV(0, 255, 100), CHSV(10, 255, 180), CHSV(20, 200, 255), CHSV(25, 180, 255),
-            CHSV(30, 180, 200), CHSV(40, 150, 150), CHSV(20, 255, 255), CHSV(10, 200, 180),
-            CHSV(0, 255, 100), CHSV(10, 255, 180), CHSV(20, 200, 255), CHSV(25, 180, 255),
-            CHSV(30, 180, 200), CHSV(40, 150, 150), CHSV(20, 255, 255), CHSV(10, 200, 180));
+    FireTribeWonderland(CRGB* ledArray, uint16_t numLeds): Animation(ledArray, numLeds, "Fire Tribe Wonderland"), gHue(0), morphStage(0), lastMorph(0) {
+        softFlamePalette = SharedPalette::fromHsv(Palettes::SOFT_FLAME);
+        sunsetGlowPalette = SharedPalette::fromHsv(Palettes::SUNSET_GLOW);
+        warmDreamPalette = SharedPalette::fromHsv(Palettes::WARM_DREAM);
 
-        sunsetGlowPalette = CRGBPalette16(
-            CHSV(5, 255, 255), CHSV(15, 200, 255), CHSV(25, 150, 230), CHSV(35, 180, 200),
-            CHSV(10, 150, 220), CHSV(20, 180, 240), CHSV(30, 160, 255), CHSV(40, 180, 255),
-            CHSV(5, 255, 255), CHSV(15, 200, 255), CHSV(25, 150, 230), CHSV(35, 180, 200),
-            CHSV(10, 150, 220), CHSV(20, 180, 240), CHSV(30, 160, 255), CHSV(40, 180, 255));
-
-        warmDreamPalette = CRGBPalette16(
-            CHSV(0, 0, 100), CHSV(10, 30, 150), CHSV(20, 50, 200), CHSV(30, 80, 220),
-            CHSV(40, 100, 255), CHSV(20, 80, 240), CHSV(10, 50, 220), CHSV(5, 30, 180),
-            CHSV(0, 0, 100), CHSV(10, 30, 150), CHSV(20, 50, 200), CHSV(30, 80, 220),
-            CHSV(40, 100, 255), CHSV(20, 80, 240), CHSV(10, 50, 220), CHSV(5, 30, 180));
+        flames.configure(numLeds);
+        flames.addSource(0, numLeds / 2 + 1);
+        flames.addSource(numLeds - 1, numLeds / 2 + 1, true);
+        flames.setCooling(60);
     }
 
-    void update() override {
-        EVERY_N_MILLISECONDS(45) {
-            gHue++;
-            t++;
-        }
+    void update(const FrameContext& frame) override {
+        gHue += hueStep.advance(frame.deltaMs, 1, 45);
 
-        if (millis() - lastMorph > 25000) {
-            morphPalette();
+        if (frame.nowMs - lastMorph > 25000) {
+            morphPalette(frame.nowMs);
         }
 
-        CRGBPalette16 palette = getCurrentPalette();
+        const CRGBPalette16& palette = getCurrentPalette();
 
-        fadeToBlackBy(leds, numLeds, 10);
-        drawLayeredWaves(palette);
-        overlayPulse();
+        drawFlames(frame, palette); // Repaints every pixel
+        overlayPulse(frame);
         sprinkleAmber();
     }
 };
@@ -512,7 +530,12 @@ private:
     uint8_t gHue;
     uint16_t noiseSeed;
     uint8_t fractalDepth;
-    CRGBPalette16 cosmicPalette;
+    PaletteBlend cosmicPalette;
+    uint8_t paletteSteps;         // Blend steps since the last new target
+    RateAccumulator retargetStep;
+    RateAccumulator hueStep;
+    RateAccumulator fadeStep; // Fade passes, one per nominal frame
+    NoiseField swirlNoise;
 
     // Sub-effect controllers
     struct QuantumParams {
@@ -522,31 +545,25 @@ private:
         uint8_t timeDilation;
     } quantumParams;
 
-    // Wormhole physics simulator (because why not?)
-    class Wormhole {
-    public:
-        float position;
-        float velocity;
-        float mass;
-        CRGB trail[5];
-        uint8_t hue;
-        QuantumParams* quantumParamsPtr;
-        uint16_t* numLedsPtr;
+    // Wormholes: 5-pixel smears that wrap through 25 off-strip pixels on
+    // either side, pulled along by gravityVector in proportion to their mass
+    ParticlePool wormholes{8};
 
-        Wormhole(QuantumParams* qp, uint16_t* nl) : position(random16()), velocity(random8(200)-100),
-                    mass(random8(50,200)), hue(random8()), quantumParamsPtr(qp), numLedsPtr(nl) {
-            for(auto& c : trail) c = CHSV(hue, 255, 128);
-        }
+    TimerWheel<CosmicChaosAnimation> timers; // State shifts and noise reseeds
+    uint32_t lastRift = 0;
 
-        void updatePhysics() {
-            velocity += quantumParamsPtr->gravityVector * (mass/100.0);
-            position = fmod(position + velocity/1000.0, *numLedsPtr + 50) - 25;
-            if(position < -24) position += *numLedsPtr + 50;
+    void spawnWormholes(uint8_t count) {
+        const int32_t fps = 1000 / NOMINAL_FRAME_MS;
+        const int32_t gravityUnit = fps * fps * 65536 / 100000; // 0.00001 px/frame^2 in Q16 px/s^2
+        wormholes.clear();
+        wormholes.setBounds(-25, numLeds + 25, ParticlePool::Edge::WRAP);
+        for(uint8_t n = 0; n < count; n++) {
+            const int32_t pos = ParticlePool::pixelCenter((int16_t)random16(numLeds + 50) - 25);
+            const int32_t vel = ((int32_t)random8(200) - 100) * fps * 65536 / 1000; // +-0.1 px/frame
+            const int32_t accel = quantumParams.gravityVector * (int32_t)random8(50,200) * gravityUnit;
+            wormholes.spawn(pos, vel, CHSV(random8(), 255, 128), 0, 5 * 256, accel);
         }
-    };
-
-    // Fix: declare as vector of Wormhole
-    std::vector<Wormhole> spacetimeAnomalies;
+    }
 
     // Move recursiveGlitter as a member function
     void recursiveGlitter(uint8_t depth, fract8 chance) {
@@ -560,89 +577,84 @@ private:
     }
 
     // Fractal plasma generator
-    void generateFractalPlasma(uint8_t depth, uint16_t x, uint16_t width) {
+    void generateFractalPlasma(uint8_t depth, uint16_t x, uint16_t width, uint16_t z) {
         if(depth == 0) return;
 
         const uint16_t mid = x + width/2;
-        const uint8_t val = inoise8(noiseSeed + x * depth, millis() >> 4);
+        const uint8_t val = inoise8(noiseSeed + x * depth, z);
 
         if(mid < numLeds) {
             leds[mid] = ColorFromPalette(cosmicPalette, val, 255, LINEARBLEND);
-            generateFractalPlasma(depth-1, x, width/2);
-            generateFractalPlasma(depth-1, mid, width/2);
+            generateFractalPlasma(depth-1, x, width/2, z);
+            generateFractalPlasma(depth-1, mid, width/2, z);
         }
     }
 
     // Palette morphing system
-    void evolveCosmicPalette() {
-        static CRGBPalette16 targetPalette = PartyColors_p;
-        static uint8_t paletteBlend = 0;
-
-        EVERY_N_MILLISECONDS(quantumParams.timeDilation * 50) {
-            nblendPaletteTowardPalette(cosmicPalette, targetPalette, 12);
-
-            if(paletteBlend++ > 128) {
-                targetPalette = CRGBPalette16(
-                    CHSV(random8(), 255, 255),
-                    CHSV(random8(), random8(128,255), 255),
-                    CHSV(random8(), 100, random8(128,255)),
-                    CHSV(random8(), 255, 255)
-                );
-                paletteBlend = 0;
-            }
+    // The blend itself runs in PaletteService; this only picks new targets
+    void evolveCosmicPalette(uint32_t deltaMs) {
+        const uint32_t steps = retargetStep.advance(deltaMs, 1, quantumParams.timeDilation * 50);
+        if(steps == 0) return;
+
+        paletteSteps = qadd8(paletteSteps, steps);
+        if(paletteSteps > 128) {
+            cosmicPalette.setTarget(CRGBPalette16(
+                CHSV(random8(), 255, 255),
+                CHSV(random8(), random8(128,255), 255),
+                CHSV(random8(), 100, random8(128,255)),
+                CHSV(random8(), 255, 255)
+            ));
+            paletteSteps = 0;
         }
     }
 
-    // State transition handler
-    void quantumStateShift() {
-        static uint32_t lastChange = 0;
-        const uint32_t chaosInterval = 15000 + random8() * 500;
+    // State transition handler, every 15-142s
+    void quantumStateShift(const FrameContext&) {
+        currentState = static_cast<ChaosState>((currentState + 1 + random8(2)) % 4); // <-- fixed missing parenthesis
 
-        if(millis() - lastChange > chaosInterval) {
-            currentState = static_cast<ChaosState>((currentState + 1 + random8(2)) % 4); // <-- fixed missing parenthesis
+        // Randomize physics parameters
+        quantumParams = {
+            random8(3,15),
+            static_cast<int8_t>(random8(2) ? 1 : -1), // explicit cast for narrowing conversion
+            random16(),
+            random8(5,25)
+        };
 
-            // Randomize physics parameters
-            quantumParams = {
-                random8(3,15),
-                static_cast<int8_t>(random8(2) ? 1 : -1), // explicit cast for narrowing conversion
-                random16(),
-                random8(5,25)
-            };
+        // Create spacetime anomalies
+        spawnWormholes(3 + random8(5));
 
-            // Create spacetime anomalies
-            spacetimeAnomalies.clear();
-            for(int i = 0; i < (3 + random8(5)); i++) {
-                spacetimeAnomalies.emplace_back(&quantumParams, &numLeds);
-            }
-
-            lastChange = millis();
-            noiseSeed = random16();
-            fractalDepth = random8(3,7);
-        }
+        cosmicPalette.setRate(12, quantumParams.timeDilation * 50);
+        noiseSeed = random16();
+        fractalDepth = random8(3,7);
     }
 
-    // STATE MACHINE COMPONENTS
-    void quantumSwirl() {
-        const uint8_t swirlSpeed = beatsin8(12, 3, 18);
-        const uint8_t baseHue = gHue + beatsin8(15, 0, 96);
+    void driftNoiseSeed(const FrameContext&) { noiseSeed += random16(32768); }
 
+    // STATE MACHINE COMPONENTS
+    void quantumSwirl(const FrameContext& frame) {
+        const uint8_t baseHue = gHue + frame.beatsin8(15, 0, 96);
+        const uint8_t swirlPhase = frame.nowMs / 20;
+
+        // Static field that only changes with the physics parameters
+        swirlNoise.configure(numLeds, quantumParams.waveDensity);
+        swirlNoise.render(0, noiseSeed);
+        uint8_t* bri = Render::gatherScratch();
         for(int i = 0; i < numLeds; i++) {
-            uint8_t hue = baseHue + inoise8(i * quantumParams.waveDensity, noiseSeed);
-            uint8_t bri = sin8(i * 3 + millis()/20);
-            leds[i] = CHSV(hue, 240, bri);
+            bri[i] = sin8(i * 3 + swirlPhase);
         }
+        Render::hsvToRgb(leds, swirlNoise.data(), baseHue, 240, bri, numLeds);
 
         recursiveGlitter(4, 30);
     }
 
-    void nebulaBurst() {
-        fadeToBlackBy(leds, numLeds, 32);
+    void nebulaBurst(const FrameContext& frame) {
+        for (uint32_t n = fadeStep.perFrame(frame.deltaMs, 1); n; n--) fadeToBlackBy(leds, numLeds, 32);
 
         // Generate fractal plasma
-        generateFractalPlasma(fractalDepth, 0, numLeds);
+        generateFractalPlasma(fractalDepth, 0, numLeds, frame.nowMs >> 4);
 
         // Add dimensional rifts
-        EVERY_N_MILLISECONDS(100) {
+        if(timers.throttle(lastRift, 100)) {
             const uint16_t pos = random16(numLeds);
             const uint8_t width = random8(3,15);
             for(int i = 0; i < width; i++) {
@@ -653,15 +665,8 @@ private:
         }
 
         // Animate wormholes
-        for(auto& wormhole : spacetimeAnomalies) {
-            wormhole.updatePhysics();
-            for(int i = 0; i < 5; i++) {
-                int pos = static_cast<int>(wormhole.position) - i;
-                if(pos >= 0 && pos < numLeds) {
-                    leds[pos] = wormhole.trail[i];
-                }
-            }
-        }
+        wormholes.update(frame.deltaMs);
+        wormholes.render(leds, numLeds);
     }
 
 public:
@@ -670,26 +675,32 @@ public:
           currentState(QUANTUM_SWIRL),
           noiseSeed(5338),
           fractalDepth(5),
-          cosmicPalette(OceanColors_p) {
+          cosmicPalette(OceanColors_p),
+          paletteSteps(0) {
 
         quantumParams = {8, 1, 1337, 15};
-        spacetimeAnomalies.emplace_back(&quantumParams, &this->numLeds);
+        cosmicPalette.setTarget(PartyColors_p);
+        cosmicPalette.setRate(12, quantumParams.timeDilation * 50);
+        spawnWormholes(1);
+
+        // Every ~15-18.5s, as the old per-frame 15000 + random8() * 500 test fired
+        timers.everyRandom(15000, 18500, &CosmicChaosAnimation::quantumStateShift);
+        timers.every(30000, &CosmicChaosAnimation::driftNoiseSeed);
     }
 
-    void update() override {
+    void update(const FrameContext& frame) override {
         // Core timing system
-        EVERY_N_MILLISECONDS(20) { gHue++; }
-        EVERY_N_SECONDS(30) { noiseSeed += random16(32768); }
+        gHue += hueStep.advance(frame.deltaMs, 1, 20);
 
         // Run state machine
-        quantumStateShift();
-        evolveCosmicPalette();
+        timers.tick(*this, frame);
+        evolveCosmicPalette(frame.deltaMs);
 
         switch(currentState) {
-            case QUANTUM_SWIRL: quantumSwirl(); break;
-            case NEBULA_BURST: nebulaBurst(); break;
-            case CHROMATIC_WORMHOLES: nebulaBurst(); break;
-            case PLASMA_TSUNAMI: quantumSwirl(); break;
+            case QUANTUM_SWIRL: quantumSwirl(frame); break;
+            case NEBULA_BURST: nebulaBurst(frame); break;
+            case CHROMATIC_WORMHOLES: nebulaBurst(frame); break;
+            case PLASMA_TSUNAMI: quantumSwirl(frame); break;
         }
 
         // Dimensional energy bleed-through
@@ -698,7 +709,7 @@ public:
         }
 
         // Temporal distortion effect
-        blur1d(leds, numLeds, beatsin8(10, 3, 15));
+        blur1d(leds, numLeds, frame.beatsin8(10, 3, 15));
     }
 };
 
@@ -717,25 +728,26 @@ private:
     bool swirlActive = false;
     uint16_t bloomPos = 0;
     uint8_t bloomRadius = 0;
-    CRGBPalette16 wonderPalette = CRGBPalette16(
-        CRGB::Lavender, CRGB::LightPink, CRGB::LightSkyBlue, CRGB::PaleGreen,
-        CRGB::Violet, CRGB::Pink, CRGB::SkyBlue, CRGB::MintCream,
-        CRGB::Orchid, CRGB::HotPink, CRGB::Turquoise, CRGB::LimeGreen,
-        CRGB::Purple, CRGB::DeepPink, CRGB::DodgerBlue, CRGB::SpringGreen
-    );
+    RateAccumulator flowStep;
+    RateAccumulator bloomStep;
+    RateAccumulator hueStep;
+    RateAccumulator fadeStep; // Fade passes, one per nominal frame
+    NoiseField flow;
+    ExpandedPalette wonder;
 
     // Internal method: Base rainbow flow layer with noise
-    void applyRainbowFlow() {
-        flowOffset += 1 + wonderFactor / 20; // Slow to faster flow
+    void applyRainbowFlow(uint32_t deltaMs) {
+        flowOffset += flowStep.perFrame(deltaMs, 1 + wonderFactor / 20); // Slow to faster flow
+        flow.render(0, flowOffset);
+        uint8_t* bright = Render::gatherScratch();
         for (int i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * 10, flowOffset);
-            uint8_t bright = sin8(noise) / 2 + 80; // Soft brightness
-            leds[i] = ColorFromPalette(wonderPalette, noise + gHue, bright, LINEARBLEND);
+            bright[i] = sin8(flow[i]) / 2 + 80; // Soft brightness
         }
+        wonder.gather(leds, flow.data(), gHue, bright, numLeds);
     }
 
     // Internal method: Blooming flowers - gentle color spreads
-    void bloomFlowers() {
+    void bloomFlowers(const FrameContext& frame) {
         if (bloomActive) {
             for (int r = 0; r < bloomRadius; r++) { // Nested loop for bloom expansion
                 int left = bloomPos - r;
@@ -743,19 +755,20 @@ private:
                 if (left >= 0) nblend(leds[left], CHSV(gHue + 64, 200, 150 - r * 10), 128); // Blend bloom
                 if (right < numLeds) nblend(leds[right], CHSV(gHue + 64, 200, 150 - r * 10), 128);
             }
-            bloomRadius += 1; // Expand
+            bloomRadius += bloomStep.perFrame(frame.deltaMs, 1); // Expand
             if (bloomRadius > 20 + wonderFactor / 5) { bloomActive = false; } // End bloom
-        } else if (millis() - lastBloom > random16(5000, 15000)) {
+        } else if (frame.nowMs - lastBloom > random16(5000, 15000)) {
             bloomActive = true;
             bloomPos = random16(numLeds);
             bloomRadius = 1;
-            lastBloom = millis();
+            bloomStep.reset();
+            lastBloom = frame.nowMs;
             if (random8() < 30) gHue += random8(32, 96); // Side effect: Hue shift on bloom
         }
     }
 
     // Internal method: Swirling mandala patterns
-    void swirlMandala() {
+    void swirlMandala(uint32_t nowMs) {
         if (swirlActive) {
             for (int i = 0; i < numLeds; i += 4 + wonderFactor / 10) { // Pattern loop with variable step
                 leds[i] = CHSV(gHue + i, 180, 200);
@@ -764,15 +777,15 @@ private:
                 if (i + 3 < numLeds) leds[i + 3].fadeLightBy(150);
             }
             if (random8() < 10) swirlActive = false; // Random end
-        } else if (millis() - lastSwirl > random16(10000, 30000)) {
+        } else if (nowMs - lastSwirl > random16(10000, 30000)) {
             swirlActive = true;
-            lastSwirl = millis();
+            lastSwirl = nowMs;
         }
     }
 
     // Internal method: Magic bursts - random color spreads with glitter
-    void magicBursts() {
-        if (millis() - lastMagicBurst > random16(20000, 60000)) {
+    void magicBursts(uint32_t nowMs) {
+        if (nowMs - lastMagicBurst > random16(20000, 60000)) {
             uint16_t burstPos = random16(numLeds);
             uint8_t burstHue = random8();
             for (int b = 0; b < 10; b++) { // Burst loop
@@ -780,26 +793,54 @@ private:
                 leds[pos] = CHSV(burstHue, 255, random8(150, 255));
                 addGlitter(50); // Side effect: Add glitter during burst
             }
-            lastMagicBurst = millis();
+            lastMagicBurst = nowMs;
             wonderFactor = min(100, wonderFactor + random8(5, 15)); // Build wonder
-            randomSeed(millis() + wonderFactor); // Reseed for creativity
         }
     }
 
 public:
     TrippyHippieWonderlandAnimation(CRGB* ledArray, uint16_t numLeds) : Animation(ledArray, numLeds, "Trippy Hippie Wonderland") {
-        randomSeed(millis()); // Seed for unique runs
+        flow.configure(numLeds, 10);
+        wonder.update(Palettes::Wonder_p);
     }
-    void update() override {
-        fadeToBlackBy(leds, numLeds, 5 + wonderFactor / 20); // Gentle fade, increases slightly
+    void update(const FrameContext& frame) override {
+        for (uint32_t n = fadeStep.perFrame(frame.deltaMs, 1); n; n--) fadeToBlackBy(leds, numLeds, 5 + wonderFactor / 20); // Gentle fade, increases slightly
 
         // Layered effects with side effects
-        applyRainbowFlow(); // Base layer
-        bloomFlowers(); // Blooms
-        swirlMandala(); // Swirls
-        magicBursts(); // Bursts
+        applyRainbowFlow(frame.deltaMs); // Base layer
+        bloomFlowers(frame); // Blooms
+        swirlMandala(frame.nowMs); // Swirls
+        magicBursts(frame.nowMs); // Bursts
 
-        EVERY_N_MILLISECONDS(30) { gHue++; } // Slow hue drift
+        gHue += hueStep.advance(frame.deltaMs, 1, 30); // Slow hue drift
     }
 };
 static Registrar<TrippyHippieWonderlandAnimation> trippyHippieWonderlandRegistrator("Trippy Hippie Wonderland");
+
+class CyclicChaosAnimation : public Animation {
+private:
+    uint8_t gHue = 0;
+    uint32_t quietMs = 0;
+    RateAccumulator hueStep;
+    CyclicAutomaton automaton;
+public:
+    CyclicChaosAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Cyclic Chaos") {
+        // 16 states: noise organises itself into waves chasing around the ring
+        automaton.configure(numLeds, 4);
+        automaton.setRate(40);
+        automaton.seedRandom();
+    }
+    void update(const FrameContext& frame) override {
+        automaton.update(frame.deltaMs);
+        // Reseed once the waves have locked into a still pattern, or on a button hit
+        quietMs = automaton.activity() ? 0 : quietMs + frame.deltaMs;
+        if (quietMs > 2000 || frame.onTrigger) {
+            automaton.seedRandom();
+            quietMs = 0;
+        }
+        automaton.render(leds, RainbowColors_p, gHue, brightness);
+        gHue += hueStep.advance(frame.deltaMs, 1, 40);
+    }
+};
+static Registrar<CyclicChaosAnimation> cyclicChaosRegistrator("Cyclic Chaos");
+
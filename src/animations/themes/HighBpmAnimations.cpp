@@ -6,11 +6,13 @@
 #include "../../config/Config.h"
 
 // ---------------------- High BPM Animations ----------------------
+// Locked to the shared tempo clock (DEFAULT_TEMPO_BPM) rather than fixed BPMs,
+// so the whole theme stays on one beat; at 120 BPM they match the old rates.
 class HeartbeatAnimation : public Animation {
 public:
     HeartbeatAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Heartbeat") {}
-    void update() override {
-        uint8_t pulse = beatsin8(40, MIN_BRIGHTNESS, brightness);
+    void update(const FrameContext& frame) override {
+        uint8_t pulse = frame.tempoSin8(3, MIN_BRIGHTNESS, brightness);
         CRGB color = CRGB::Red;
         color.fadeToBlackBy(220 - pulse);
         fill_solid(leds, numLeds, color);
@@ -21,8 +23,8 @@ static Registrar<HeartbeatAnimation> heartbeatRegistrator("Heartbeat");
 class StrobePulseAnimation : public Animation {
 public:
     StrobePulseAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Strobe Pulse -NoShuffle") {}
-    void update() override {
-        uint8_t pulse = beatsin8(120, 50, 255);
+    void update(const FrameContext& frame) override {
+        uint8_t pulse = frame.tempoSin8(1, 50, 255);
         CRGB color = pulse > 200 ? CRGB(CHSV(random8(), 255, brightness)) : CRGB::Black;
         fill_solid(leds, numLeds, color);
     }
@@ -31,18 +33,21 @@ static Registrar<StrobePulseAnimation> strobePulseRegistrator("Strobe Pulse -NoS
 
 class BeatScannerAnimation : public Animation {
 private:
-    uint16_t pos = 0;
     uint8_t gHue = 0;
+    RateAccumulator hueStep;
+    CometTrails scanners;
 public:
-    BeatScannerAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Beat Scanner") {}
-    void update() override {
-        EVERY_N_MILLISECONDS(20) {
-            pos = beatsin16(60, 0, numLeds-1);
-            fadeToBlackBy(leds, numLeds, 50);
-            leds[pos] += CHSV(gHue, 255, brightness);
-            leds[(numLeds-1)-pos] += CHSV(gHue+128, 255, brightness);
-            gHue += 2;
-        }
+    BeatScannerAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Beat Scanner") {
+        scanners.configure(numLeds, 50, 20);
+    }
+    void update(const FrameContext& frame) override {
+        scanners.advance(frame.deltaMs);
+        const int32_t pos = CometTrails::sweep(frame.tempoSin16(2), numLeds);
+        const int32_t mirrored = ((int32_t)(numLeds - 1) << 16) - pos;
+        scanners.moveTo(0, pos, CHSV(gHue, 255, brightness));
+        scanners.moveTo(1, mirrored, CHSV(gHue + 128, 255, brightness));
+        scanners.render(leds);
+        gHue += hueStep.advance(frame.deltaMs, 2, 20);
     }
 };
 static Registrar<BeatScannerAnimation> beatScannerRegistrator("Beat Scanner");
@@ -50,14 +55,15 @@ static Registrar<BeatScannerAnimation> beatScannerRegistrator("Beat Scanner");
 class ColorSlamAnimation : public Animation {
 private:
     uint8_t lastBeat = 0;
+    RateAccumulator fadeStep; // Fade passes, one per nominal frame
 public:
     ColorSlamAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Color Slam") {}
-    void update() override {
-        uint8_t beat = beatsin8(60, 0, 100);
+    void update(const FrameContext& frame) override {
+        uint8_t beat = frame.tempoSin8(2, 0, 100);
         if (beat < 10 && lastBeat >= 10)
             fill_solid(leds, numLeds, CHSV(random8(), 255, brightness));
         else
-            fadeToBlackBy(leds, numLeds, 30);
+            for (uint32_t n = fadeStep.perFrame(frame.deltaMs, 1); n; n--) fadeToBlackBy(leds, numLeds, 30);
         lastBeat = beat;
     }
 };
@@ -67,12 +73,14 @@ class BeatDropAnimation : public Animation {
 private:
     uint8_t dropCounter = 0;
     uint8_t gHue = 0;
+    RateAccumulator dropStep;
 public:
     BeatDropAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Beat Drop") {}
-    void update() override {
-        EVERY_N_MILLISECONDS(50) {
+    void update(const FrameContext& frame) override {
+        // One drop step per 50ms, however long the frame took
+        for (uint32_t steps = dropStep.advance(frame.deltaMs, 1, 50); steps > 0; steps--) {
             if (dropCounter == 0)
-                fill_solid(leds, numLeds, CHSV(gHue, 255, beatsin8(30, 50, 150)));
+                fill_solid(leds, numLeds, CHSV(gHue, 255, frame.tempoSin8(4, 50, 150)));
             else if (dropCounter < 10)
                 fill_solid(leds, numLeds, CRGB::White);
             else {
@@ -89,6 +97,25 @@ public:
 };
 static Registrar<BeatDropAnimation> beatDropRegistrator("Beat Drop");
 
+class BeatRipplesAnimation : public Animation {
+private:
+    RippleField water;
+public:
+    BeatRipplesAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Beat Ripples") {
+        water.configure(numLeds);
+        water.setDamping(245);
+        water.setSpeed(3);
+    }
+    void update(const FrameContext& frame) override {
+        // A splash somewhere on every beat, a harder one on the bar or a button hit
+        if (frame.onBeat) water.drop(random16(numLeds), RippleField::FULL_SCALE, 2);
+        if (frame.onBar || frame.onTrigger) water.drop(random16(numLeds), RippleField::FULL_SCALE * 3 / 2, 4);
+        water.update(frame.deltaMs);
+        water.render(leds, PartyColors_p, brightness, true);
+    }
+};
+static Registrar<BeatRipplesAnimation> beatRipplesRegistrator("Beat Ripples");
+
 // ---------------------- Memory Leak Review ----------------------
 // - No dynamic allocations within update() methods => ✅
 // - Animation registry uses `new` but matches AnimationManager's management model => ✅
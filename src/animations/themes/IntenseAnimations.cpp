@@ -8,14 +8,21 @@
 class HyperSpinAnimation : public Animation {
 private:
     uint16_t angle = 0;
+    RateAccumulator spinStep;
+    ExpandedPalette stripes;
 public:
-    HyperSpinAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Hyper Spin") {}
-    void update() override {
-        angle += beatsin16(60, 10, 30);
+    HyperSpinAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Hyper Spin") {
+        stripes.update(RainbowStripeColors_p);
+    }
+    void update(const FrameContext& frame) override {
+        // Spin speed and pulse follow the shared tempo (2 beats and 1 beat)
+        angle += spinStep.perFrame(frame.deltaMs, frame.tempoSin16(2, 10, 30));
+        const uint8_t pulse = frame.tempoSin8(1, 200, brightness);
+        uint8_t* colorIndex = Render::gatherScratch();
         for (int i = 0; i < numLeds; i++) {
-            uint8_t colorIndex = (i * 10) - angle;
-            leds[i] = ColorFromPalette(RainbowStripeColors_p, colorIndex, beatsin8(120, 200, brightness), LINEARBLEND);
+            colorIndex[i] = (i * 10) - angle;
         }
+        stripes.gather(leds, colorIndex, 0, pulse, numLeds);
     }
 };
 static Registrar<HyperSpinAnimation> hyperSpinRegistrator("Hyper Spin");
@@ -23,13 +30,14 @@ static Registrar<HyperSpinAnimation> hyperSpinRegistrator("Hyper Spin");
 class BeatTrailsAnimation : public Animation {
 private:
     uint8_t gHue = 0;
+    RateAccumulator hueStep;
 public:
     BeatTrailsAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Beat Trails") {}
-    void update() override {
+    void update(const FrameContext& frame) override {
        // fadeToBlackBy(leds, numLeds, 40);
-        int pos = beatsin16(30, 0, numLeds-1);
+        int pos = frame.tempoSin16(4, 0, numLeds-1); // One sweep per bar
         leds[pos] += CHSV(gHue, 255, brightness);
-        EVERY_N_MILLISECONDS(10) { gHue++; }
+        gHue += hueStep.perFrame(frame.deltaMs, 1); // 10ms timer used to fire once per frame
     }
 };
 static Registrar<BeatTrailsAnimation> beatTrailsRegistrator("Beat Trails");
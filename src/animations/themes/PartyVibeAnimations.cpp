@@ -10,13 +10,13 @@ class RainbowMarchAnimation : public Animation {
 private:
     uint8_t thishue = 0;
     uint8_t deltahue = 2;
+    RateAccumulator hueStep;
 public:
     RainbowMarchAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Rainbow March") {}
-    void update() override {
-        EVERY_N_MILLISECONDS(10) {
-            fill_rainbow(leds, numLeds, thishue, deltahue);
-            thishue += 5;
-        }
+    void update(const FrameContext& frame) override {
+        // The old 10ms timer fired at most once per frame, so the tuned speed is 5 per frame
+        Render::fillRainbow(leds, numLeds, thishue, deltahue);
+        thishue += hueStep.perFrame(frame.deltaMs, 5);
     }
 };
 static Registrar<RainbowMarchAnimation> rainbowMarchRegistrator("Rainbow March");
@@ -24,13 +24,24 @@ static Registrar<RainbowMarchAnimation> rainbowMarchRegistrator("Rainbow March")
 class ConfettiAnimation : public Animation {
 private:
     uint8_t gHue = 0;
+    RateAccumulator hueStep;
+    RateAccumulator sparkStep;
+    SparkleField sparks;
 public:
-    ConfettiAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Confetti") {}
-    void update() override {
-        fadeToBlackBy(leds, numLeds, 10);
-        int pos = random16(numLeds);
-        leds[pos] += CHSV(gHue + random8(64), 200, brightness);
-        EVERY_N_MILLISECONDS(20) { gHue++; }
+    ConfettiAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Confetti") {
+        sparks.configure(numLeds, 10);
+    }
+    void update(const FrameContext& frame) override {
+        sparks.update(frame.deltaMs);
+        // One spark per nominal frame anywhere on the strip
+        for (uint32_t n = sparkStep.perFrame(frame.deltaMs, 1); n > 0; n--) {
+            sparks.light(random16(numLeds), CHSV(gHue + random8(64), 200, brightness));
+        }
+        sparks.render(leds);
+        gHue += hueStep.advance(frame.deltaMs, 1, 20);
+    }
+    bool changedPixels(const uint16_t*& list, uint16_t& count) const override {
+        return sparks.changed(list, count);
     }
 };
 static Registrar<ConfettiAnimation> confettiRegistrator("Confetti");
@@ -38,45 +49,54 @@ static Registrar<ConfettiAnimation> confettiRegistrator("Confetti");
 class BpmAnimation : public Animation {
 private:
     uint8_t gHue = 0;
+    RateAccumulator hueStep;
 public:
     BpmAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "BPM") {}
-    void update() override {
-        uint8_t beat = beatsin8(62, 64, brightness);
+    void update(const FrameContext& frame) override {
+        uint8_t beat = frame.beatsin8(62, 64, brightness);
         for (int i = 0; i < numLeds; i++) {
             leds[i] = ColorFromPalette(PartyColors_p, gHue + (i * 2), beat - gHue + (i * 10));
         }
-        EVERY_N_MILLISECONDS(20) { gHue++; }
+        gHue += hueStep.advance(frame.deltaMs, 1, 20);
     }
 };
 static Registrar<BpmAnimation> bpmRegistrator("BPM");
 
 class TwinkleStarsAnimation : public Animation {
+private:
+    RateAccumulator twinkleStep;
+    SparkleField twinkles;
 public:
-    TwinkleStarsAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Twinkle Stars") {}
-    void update() override {
-        fadeToBlackBy(leds, numLeds, 10);
-        int pos = random16(numLeds);
-        leds[pos] += CHSV(random8(64, 192), 200, brightness);
+    TwinkleStarsAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Twinkle Stars") {
+        twinkles.configure(numLeds, 10);
+    }
+    void update(const FrameContext& frame) override {
+        twinkles.update(frame.deltaMs);
+        for (uint32_t n = twinkleStep.perFrame(frame.deltaMs, 1); n > 0; n--) {
+            twinkles.light(random16(numLeds), CHSV(random8(64, 192), 200, brightness));
+        }
+        twinkles.render(leds);
+    }
+    bool changedPixels(const uint16_t*& list, uint16_t& count) const override {
+        return twinkles.changed(list, count);
     }
 };
 static Registrar<TwinkleStarsAnimation> twinkleStarsRegistrator("Twinkle Stars");
 
 class ColorWavesAnimation : public Animation {
 private:
-    uint16_t sPseudotime = 0, sLastMillis = 0, sHue16 = 0;
+    uint16_t sPseudotime = 0, sHue16 = 0;
 public:
     ColorWavesAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Color Waves") {}
-    void update() override {
-        uint8_t brightdepth = scale8(beatsin88(341, 96, 224), brightness);
-        uint16_t brightnessthetainc16 = beatsin88(203, 25 * 256, 40 * 256);
-        uint8_t msmultiplier = beatsin88(147, 23, 60);
+    void update(const FrameContext& frame) override {
+        uint8_t brightdepth = scale8(frame.beatsin88(341, 96, 224), brightness);
+        uint16_t brightnessthetainc16 = frame.beatsin88(203, 25 * 256, 40 * 256);
+        uint8_t msmultiplier = frame.beatsin88(147, 23, 60);
         uint16_t hue16 = sHue16;
-        uint16_t hueinc16 = beatsin88(113, 1, 3000);
-        uint16_t ms = millis();
-        uint16_t deltams = ms - sLastMillis;
-        sLastMillis = ms;
+        uint16_t hueinc16 = frame.beatsin88(113, 1, 3000);
+        uint16_t deltams = frame.deltaMs;
         sPseudotime += deltams * msmultiplier;
-        sHue16 += deltams * beatsin88(400, 5, 9);
+        sHue16 += deltams * frame.beatsin88(400, 5, 9);
         uint16_t brightnesstheta16 = sPseudotime;
         for (uint16_t i = 0; i < numLeds; i++) {
             hue16 += hueinc16;
@@ -93,23 +113,23 @@ static Registrar<ColorWavesAnimation> colorWavesRegistrator("Color Waves");
 
 class TwoSinAnimation : public Animation {
 private:
-    uint8_t wavebright = 128, thathue = 80;
     uint8_t thisrot = 1, thatrot = 0, allsat = 255;
-    uint8_t thisspeed = 1, thatspeed = 1;
-    uint8_t allfreq = 32, thisphase = 0, thatphase = 0;
-    uint8_t thiscutoff = 96, thatcutoff = 96;
+    WaveBank waves;
+    uint8_t thisWave, thatWave;
 public:
-    TwoSinAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Two Sin") {}
-    void update() override {
-        thisphase += thisspeed;
-        thatphase += thatspeed;
+    TwoSinAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Two Sin") {
+        // cubicwave8(k * 32 + phase) less a cutoff of 96, the second half a period behind
+        thisWave = waves.add(WaveBank::Shape::CUBIC, 32, 1, 0, 96);
+        thatWave = waves.add(WaveBank::Shape::CUBIC, 32, 1, 128, 96);
+    }
+    void update(const FrameContext& frame) override {
+        waves.advance(frame.deltaMs);
         uint8_t thishue = thisrot, thathue2 = thishue + 128 + thatrot;
-        for (int k = 0; k < numLeds; k++) {
-            int thisbright = qsuba(cubicwave8((k * allfreq) + thisphase), thiscutoff);
-            int thatbright = qsuba(cubicwave8((k * allfreq) + 128 + thatphase), thatcutoff);
-            leds[k] = CHSV(thishue, allsat, thisbright);
-            leds[k] += CHSV(thathue2, allsat, thatbright);
-        }
+        uint8_t* bright = Render::gatherScratch();
+        waves.render(thisWave, bright, numLeds);
+        Render::shadeHue(leds, thishue, allsat, bright, numLeds);
+        waves.render(thatWave, bright, numLeds);
+        Render::shadeHue(leds, thathue2, allsat, bright, numLeds, true);
     }
 };
 static Registrar<TwoSinAnimation> twoSinRegistrator("Two Sin");
@@ -117,18 +137,18 @@ static Registrar<TwoSinAnimation> twoSinRegistrator("Two Sin");
 
 class ThreeSinAnimation : public Animation {
 private:
-    uint8_t wave1 = 0, wave2 = 0, wave3 = 0;
-    uint8_t inc1 = 2, inc2 = 1; int8_t inc3 = -3;
-    uint8_t lvl1 = 80, lvl2 = 80, lvl3 = 80;
-    uint8_t mul1 = 5, mul2 = 8, mul3 = 7;
+    WaveBank waves;
 public:
-    ThreeSinAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Three Sin") {}
-    void update() override {
-        wave1 += inc1; wave2 += inc2; wave3 += inc3;
-        for (int k = 0; k < numLeds; k++) {
-            leds[k].r = qsub8(sin8(mul1 * k + wave1), lvl1);
-            leds[k].g = qsub8(sin8(mul2 * k + wave2), lvl2);
-            leds[k].b = qsub8(sin8(mul3 * k + wave3), lvl3);
+    ThreeSinAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Three Sin") {
+        // One wave per channel: sin8(mul * k + wave) less 80
+        waves.add(WaveBank::Shape::SINE, 5, 2, 0, 80);
+        waves.add(WaveBank::Shape::SINE, 8, 1, 0, 80);
+        waves.add(WaveBank::Shape::SINE, 7, -3, 0, 80);
+    }
+    void update(const FrameContext& frame) override {
+        waves.advance(frame.deltaMs);
+        for (uint8_t c = 0; c < 3; c++) {
+            waves.render(c, &leds[0].raw[c], numLeds, sizeof(CRGB));
         }
     }
 };
@@ -137,17 +157,21 @@ static Registrar<ThreeSinAnimation> threeSinRegistrator("Three Sin");
 
 class PlasmaEffectTwoAnimation : public Animation {
 private:
-    unsigned long plasmaTime = 0;
+    WaveBank plasma;
+    ExpandedPalette rainbow;
 public:
-    PlasmaEffectTwoAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Plasma Effect 2") {}
-    void update() override {
-        plasmaTime += 20;
-        for (int i = 0; i < numLeds; i++) {
-            int x = i * 10;
-            int y = plasmaTime / 10;
-            int colorIndex = sin8(x + y) + cos8(x - y);
-            leds[i] = ColorFromPalette(RainbowColors_p, colorIndex, brightness);
-        }
+    PlasmaEffectTwoAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Plasma Effect 2") {
+        rainbow.update(RainbowColors_p);
+        // sin8(x + y) + cos8(x - y) with x = 10 per pixel and y = 2 per frame
+        plasma.add(WaveBank::Shape::SINE, 10, 2);
+        plasma.add(WaveBank::Shape::SINE, 10, -2, 64);
+    }
+    void update(const FrameContext& frame) override {
+        plasma.advance(frame.deltaMs);
+        uint8_t* colorIndex = Render::gatherScratch();
+        plasma.render(0, colorIndex, numLeds);
+        plasma.render(1, colorIndex, numLeds, 1, true);
+        rainbow.gather(leds, colorIndex, 0, brightness, numLeds);
     }
 };
 static Registrar<PlasmaEffectTwoAnimation> plasmaEffectTwoAnimationRegistrator("Plasma Effect 2");
@@ -156,16 +180,21 @@ class LavaLampAnimationTwo : public Animation {
 private:
     uint32_t x = 0;
     unsigned long lastBrightnessChange = 0;
+    RateAccumulator xStep;
+    NoiseField lava;
 public:
-    LavaLampAnimationTwo(CRGB* leds, uint16_t count) : Animation(leds, count, "Lava Lamp 2") {}
-    void update() override {
-        x += 10;
+    LavaLampAnimationTwo(CRGB* leds, uint16_t count) : Animation(leds, count, "Lava Lamp 2") {
+        lava.configure(numLeds, 50);
+    }
+    void update(const FrameContext& frame) override {
+        x += xStep.perFrame(frame.deltaMs, 10);
+        lava.render(0, x);
+        uint8_t* hue = Render::gatherScratch();
         for (int i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * 50, x);
-            uint8_t hue = map(noise, 0, 255, 10, 30);
-            leds[i] = CHSV(hue, 255, noise);
+            hue[i] = map(lava[i], 0, 255, 10, 30);
         }
-        unsigned long currentMillis = millis();
+        Render::hsvToRgb(leds, hue, 0, 255, lava.data(), numLeds);
+        unsigned long currentMillis = frame.nowMs;
         if (currentMillis - lastBrightnessChange > 30000) {
             FastLED.setBrightness(random8(MIN_BRIGHTNESS + 20, brightness - 20));
             lastBrightnessChange = currentMillis;
@@ -7,43 +7,41 @@
 
 class TwoSinPsyAnimation : public Animation {
 private:
-    uint8_t wavebright = 128, thathue = 80;
     uint8_t thisrot = 1, thatrot = 0, allsat = 255;
-    uint8_t thisspeed = 1, thatspeed = 1;
-    uint8_t allfreq = 32, thisphase = 0, thatphase = 0;
-    uint8_t thiscutoff = 96, thatcutoff = 96;
+    WaveBank waves;
+    uint8_t thisWave, thatWave;
 public:
-    TwoSinPsyAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Two Sin Psy") {}
-    void update() override {
-        thisphase += thisspeed;
-        thatphase += thatspeed;
+    TwoSinPsyAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Two Sin Psy") {
+        // cubicwave8(k * 32 + phase) less a cutoff of 96, the second half a period behind
+        thisWave = waves.add(WaveBank::Shape::CUBIC, 32, 1, 0, 96);
+        thatWave = waves.add(WaveBank::Shape::CUBIC, 32, 1, 128, 96);
+    }
+    void update(const FrameContext& frame) override {
+        waves.advance(frame.deltaMs);
         uint8_t thishue = thisrot, thathue2 = thishue + 128 + thatrot;
-        for (int k = 0; k < numLeds; k++) {
-            int thisbright = qsuba(cubicwave8((k*allfreq)+thisphase), thiscutoff);
-            int thatbright = qsuba(cubicwave8((k*allfreq)+128+thatphase), thatcutoff);
-            leds[k] = CHSV(thishue, allsat, thisbright);
-            leds[k] += CHSV(thathue2, allsat, thatbright);
-        }
+        uint8_t* bright = Render::gatherScratch();
+        waves.render(thisWave, bright, numLeds);
+        Render::shadeHue(leds, thishue, allsat, bright, numLeds);
+        waves.render(thatWave, bright, numLeds);
+        Render::shadeHue(leds, thathue2, allsat, bright, numLeds, true);
     }
 };
 static Registrar<TwoSinPsyAnimation> twoSinPsyRegistrator("Two Sin nPsy");
 
 class ThreeSinTwoAnimation : public Animation {
 private:
-    uint8_t wave1 = 0, wave2 = 0, wave3 = 0;
-    uint8_t inc1 = 2, inc2 = 1; int8_t inc3 = -3;
-    uint8_t lvl1 = 80, lvl2 = 80, lvl3 = 80;
-    uint8_t mul1 = 5, mul2 = 8, mul3 = 7;
+    WaveBank waves;
 public:
-    ThreeSinTwoAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Three Sin Two") {}
-    void update() override {
-        wave1 += inc1;
-        wave2 += inc2;
-        wave3 += inc3;
-        for (int k=0; k<numLeds; k++) {
-            leds[k].r = qsub8(sin8(mul1*k + wave1), lvl1);
-            leds[k].g = qsub8(sin8(mul2*k + wave2), lvl2);
-            leds[k].b = qsub8(sin8(mul3*k + wave3), lvl3);
+    ThreeSinTwoAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Three Sin Two") {
+        // One wave per channel: sin8(mul * k + wave) less 80
+        waves.add(WaveBank::Shape::SINE, 5, 2, 0, 80);
+        waves.add(WaveBank::Shape::SINE, 8, 1, 0, 80);
+        waves.add(WaveBank::Shape::SINE, 7, -3, 0, 80);
+    }
+    void update(const FrameContext& frame) override {
+        waves.advance(frame.deltaMs);
+        for (uint8_t c = 0; c < 3; c++) {
+            waves.render(c, &leds[0].raw[c], numLeds, sizeof(CRGB));
         }
     }
 };
@@ -56,11 +54,11 @@ private:
     uint32_t colours[1] = { 0x13b0f2 };
 public:
     PopFadeAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Pop Fade") {}
-    void update() override {
+    void update(const FrameContext&) override {
         unsigned long thiscolour = colours[0];
         int idex = random16(0, ranamount);
         if (idex < numLeds) {
-            if (boolcolours) thiscolour = random(0xFFFFFF);
+            if (boolcolours) thiscolour = (uint32_t)random16() << 8 | random8();
             int barlen = random16(1, maxbar);
             for (int i = 0; i < barlen && (idex + i < numLeds); i++) {
                 leds[idex + i] = thiscolour;
@@ -73,17 +71,21 @@ static Registrar<PopFadeAnimation> popFadeRegistrator("Pop Fade");
 
 class PlasmaEffectAnimation : public Animation {
 private:
-    unsigned long plasmaTime = 0;
+    WaveBank plasma;
+    ExpandedPalette rainbow;
 public:
-    PlasmaEffectAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Plasma Effect") {}
-    void update() override {
-        plasmaTime += 20;
-        for (int i = 0; i < numLeds; i++) {
-            int x = i * 10;
-            int y = plasmaTime / 10;
-            int colorIndex = sin8(x + y) + cos8(x - y);
-            leds[i] = ColorFromPalette(RainbowColors_p, colorIndex, brightness);
-        }
+    PlasmaEffectAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Plasma Effect") {
+        rainbow.update(RainbowColors_p);
+        // sin8(x + y) + cos8(x - y) with x = 10 per pixel and y = 2 per frame
+        plasma.add(WaveBank::Shape::SINE, 10, 2);
+        plasma.add(WaveBank::Shape::SINE, 10, -2, 64);
+    }
+    void update(const FrameContext& frame) override {
+        plasma.advance(frame.deltaMs);
+        uint8_t* colorIndex = Render::gatherScratch();
+        plasma.render(0, colorIndex, numLeds);
+        plasma.render(1, colorIndex, numLeds, 1, true);
+        rainbow.gather(leds, colorIndex, 0, brightness, numLeds);
     }
 };
 static Registrar<PlasmaEffectAnimation> plasmaEffectRegistrator("Plasma Effect");
@@ -92,16 +94,21 @@ class LavaLampAnimation : public Animation {
 private:
     uint32_t x = 0;
     unsigned long lastBrightnessChange = 0;
+    RateAccumulator xStep;
+    NoiseField lava;
 public:
-    LavaLampAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Lava Lamp") {}
-    void update() override {
-        x += 10;
+    LavaLampAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Lava Lamp") {
+        lava.configure(numLeds, 50);
+    }
+    void update(const FrameContext& frame) override {
+        x += xStep.perFrame(frame.deltaMs, 10);
+        lava.render(0, x);
+        uint8_t* hue = Render::gatherScratch();
         for (int i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * 50, x);
-            uint8_t hue = map(noise, 0, 255, 10, 30);
-            leds[i] = CHSV(hue, 255, noise);
+            hue[i] = map(lava[i], 0, 255, 10, 30);
         }
-        unsigned long currentMillis = millis();
+        Render::hsvToRgb(leds, hue, 0, 255, lava.data(), numLeds);
+        unsigned long currentMillis = frame.nowMs;
         if (currentMillis - lastBrightnessChange > 30000) {
             FastLED.setBrightness(random8(MIN_BRIGHTNESS + 20, brightness - 20));
             lastBrightnessChange = currentMillis;
@@ -109,3 +116,43 @@ public:
     }
 };
 static Registrar<LavaLampAnimation> lavaLampRegistrator("Lava Lamp");
+
+class RuleWeaverAnimation : public Animation {
+private:
+    uint8_t ruleIndex = 0;
+    uint8_t gHue = 0;
+    uint32_t ruleElapsed = 0;
+    RateAccumulator hueStep;
+    ElementaryAutomaton automaton;
+    CRGBPalette16 wonder = Palettes::Wonder_p;
+
+    // Rules 90 and 150 grow fractals from one cell; the rest start from noise
+    void startRule() {
+        static const uint8_t rules[] = {30, 90, 110, 150, 45, 105, 73};
+        const uint8_t rule = rules[ruleIndex++ % sizeof(rules)];
+        automaton.setRule(rule);
+        if (rule == 90 || rule == 150) automaton.seedSingle(numLeds / 2);
+        else automaton.seedRandom(96);
+        ruleElapsed = 0;
+    }
+public:
+    RuleWeaverAnimation(CRGB* leds, uint16_t count) : Animation(leds, count, "Rule Weaver") {
+        automaton.configure(numLeds);
+        automaton.setRate(30);
+        automaton.setTrailFade(12);
+        startRule();
+    }
+    void update(const FrameContext& frame) override {
+        ruleElapsed += frame.deltaMs;
+        const uint16_t population = automaton.population();
+        // A new rule every 20s, on a button hit, or when the row dies out or fills up
+        if (ruleElapsed >= 20000 || frame.onTrigger || population == 0 || population == numLeds) {
+            startRule();
+        }
+        automaton.update(frame.deltaMs);
+        automaton.render(leds, wonder, gHue, brightness);
+        gHue += hueStep.advance(frame.deltaMs, 1, 50);
+    }
+};
+static Registrar<RuleWeaverAnimation> ruleWeaverRegistrator("Rule Weaver");
+
@@ -9,18 +9,14 @@
 class RainbowWithGlitterAnimation : public Animation {
 private:
     uint8_t gHue;
-    void addGlitter(fract8 chanceOfGlitter) {
-        if (random8() < chanceOfGlitter) {
-            leds[random16(numLeds)] += CRGB::White;
-        }
-    }
+    RateAccumulator hueStep;
 public:
     RainbowWithGlitterAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Rainbow with Glitter"), gHue(0) {}
-    void update() override {
-        fill_rainbow(leds, numLeds, gHue, 7);
+    void update(const FrameContext& frame) override {
+        Render::fillRainbow(leds, numLeds, gHue, 7);
         addGlitter(80);
-        EVERY_N_MILLISECONDS(20) { gHue++; }
+        gHue += hueStep.advance(frame.deltaMs, 1, 20);
     }
 };
 static Registrar<RainbowWithGlitterAnimation> rainbowWithGlitterRegistrar("Rainbow with Glitter");
@@ -37,10 +33,8 @@ private:
         float phaseShift;      // Phase offset for waves
     } state;
 
-    // Palette morphing system
-    CRGBPalette256 currentPalette;
-    CRGBPalette256 targetPalette;
-    float paletteBlendProgress;
+    // Palette morphing system; PaletteService walks it toward each new target
+    PaletteBlend palette;
 
     // Wave parameters
     struct Wave {
@@ -50,119 +44,131 @@ private:
         float phase;
     } waveA, waveB, waveC;
 
+    // Per-frame terms of dreamPixel() in fixed point (see FixedMath.h)
+    struct PixelTerms {
+        uint32_t wavePhase[3];  // Q32 turns at pixel 0
+        uint32_t waveStep[3];   // Q32 turns per pixel
+        int16_t waveAmp[3];     // Q15
+        int32_t hueBase;        // Q16 hue units
+        int32_t hueDrift;       // Q16 hue units per pixel
+        int32_t pulseOrigin;    // Q16 pulse distance at pixel 0, in pulse widths
+        int32_t pulseStep;      // Q24 pulse distance per pixel
+    } terms;
+
+    TimerWheel<LiquidDreamAnimation> timers; // Palette and wave reshuffles
+    uint32_t lastBlur = 0;
+
     // Timeless helpers
     float lerp(float a, float b, float t) {
         return a + t * (b - a);
     }
 
-    float smoothstep(float edge0, float edge1, float x) {
-        x = constrain((x - edge0) / (edge1 - edge0), 0.0, 1.0);
-        return x * x * (3 - 2 * x);
+    // Create dreamy palette transitions, every 7 minutes
+    void evolvePalette(const FrameContext&) {
+        // Generate new target palette
+        CHSV baseColor = CHSV(random8(), 180 + random8(40), 200);
+        palette.setTarget(CRGBPalette16(
+            baseColor,
+            CHSV((baseColor.hue + 85) % 255, 200, 255),
+            CHSV((baseColor.hue + 170) % 255, 160, 180),
+            CHSV((baseColor.hue + 200) % 255, 220, 200)
+        ));
     }
 
-    // Create dreamy palette transitions
-    void evolvePalette() {
-        EVERY_N_MINUTES(7) {
-            // Generate new target palette
-            CHSV baseColor = CHSV(random8(), 180 + random8(40), 200);
-            targetPalette = CRGBPalette256(
-                baseColor,
-                CHSV((baseColor.hue + 85) % 255, 200, 255),
-                CHSV((baseColor.hue + 170) % 255, 160, 180),
-                CHSV((baseColor.hue + 200) % 255, 220, 200)
-            );
-            paletteBlendProgress = 0.0;
-        }
+    // Wave evolution, every 3 minutes
+    void reshapeWaves(const FrameContext&) {
+        waveA.amplitude = 0.3 + random8(20)/100.0;
+        waveA.frequency = 0.01 + random8(10)/1000.0;
+        waveA.speed = 0.00002 + random8(10)/1000000.0;
 
-        // Gradually blend palettes over 90 seconds
-        if(paletteBlendProgress < 1.0) {
-            paletteBlendProgress += 0.0001;  // ~90s transition
-            // Blend only a subset per frame to avoid blocking
-            static uint8_t blendIndex = 0;
-            for(int i = 0; i < 16; i++) { // Blend 16 entries per frame
-                uint8_t idx = (blendIndex + i) % 256;
-                currentPalette[idx] = blend(
-                    currentPalette[idx],
-                    targetPalette[idx],
-                    (uint8_t)(255 * smoothstep(0, 1, paletteBlendProgress))
-                );
-            }
-            blendIndex = (blendIndex + 16) % 256;
-        }
+        waveB.amplitude = 0.2 + random8(15)/100.0;
+        waveB.frequency = 0.015 + random8(15)/1000.0;
+        waveB.speed = -0.00003 + random8(10)/1000000.0;
+
+        waveC.amplitude = 0.15 + random8(10)/100.0;
+        waveC.frequency = 0.025 + random8(20)/1000.0;
+        waveC.speed = 0.000015 + random8(5)/1000000.0;
     }
 
     // Update dream state with slow drifts
-    void evolveDreamState() {
+    void evolveDreamState(const FrameContext& frame) {
+        const float frames = framesElapsed(frame.deltaMs);
         // Hours-long hue cycle (1 full cycle per ~2 hours)
-        state.hue += 0.0001;
+        state.hue += 0.0001 * frames;
         if (state.hue >= 256.0) state.hue -= 256.0;
 
         // Slowly drifting parameters
-        state.hueDrift = sin8(millis() / 42000.0) / 512.0;
-        state.pulseCenter = 0.5 + 0.3 * sin8(millis() / 38000.0) / 255.0;
-        state.pulseWidth = 0.2 + 0.1 * sin8(millis() / 57000.0) / 255.0;
-        state.energyFlow += 0.00003;
+        state.hueDrift = sin8(frame.nowMs / 42000.0) / 512.0;
+        state.pulseCenter = 0.5 + 0.3 * sin8(frame.nowMs / 38000.0) / 255.0;
+        state.pulseWidth = 0.2 + 0.1 * sin8(frame.nowMs / 57000.0) / 255.0;
+        state.energyFlow += 0.00003 * frames;
         if (state.energyFlow >= 1.0) state.energyFlow -= 1.0;
-        state.phaseShift = sin8(millis() / 29000.0) / 255.0;
-
-        // Wave evolution (changes every few minutes)
-        EVERY_N_MINUTES(3) {
-            waveA.amplitude = 0.3 + random8(20)/100.0;
-            waveA.frequency = 0.01 + random8(10)/1000.0;
-            waveA.speed = 0.00002 + random8(10)/1000000.0;
+        state.phaseShift = sin8(frame.nowMs / 29000.0) / 255.0;
 
-            waveB.amplitude = 0.2 + random8(15)/100.0;
-            waveB.frequency = 0.015 + random8(15)/1000.0;
-            waveB.speed = -0.00003 + random8(10)/1000000.0;
+        // Time term of each wave, shared by every pixel this frame
+        waveA.phase = frame.nowMs * waveA.speed;
+        waveB.phase = frame.nowMs * waveB.speed + state.phaseShift;
+        waveC.phase = frame.nowMs * waveC.speed;
+        prepareTerms();
+    }
 
-            waveC.amplitude = 0.15 + random8(10)/100.0;
-            waveC.frequency = 0.025 + random8(20)/1000.0;
-            waveC.speed = 0.000015 + random8(5)/1000000.0;
+    // Float state -> fixed-point terms, once per frame instead of per pixel
+    void prepareTerms() {
+        const Wave* waves[3] = {&waveA, &waveB, &waveC};
+        for (uint8_t k = 0; k < 3; k++) {
+            terms.wavePhase[k] = FixedMath::turnsToPhase(waves[k]->phase);
+            terms.waveStep[k] = (uint32_t)(waves[k]->frequency * 4294967296.0f);
+            terms.waveAmp[k] = waves[k]->amplitude * 32768;
         }
+        terms.wavePhase[2] += 0x40000000UL; // Third wave is a cosine
+
+        terms.hueBase = FixedMath::toQ16(state.hue + state.energyFlow * 60);
+        terms.hueDrift = FixedMath::toQ16(state.hueDrift);
+
+        const float invWidth = 1.0f / state.pulseWidth;
+        terms.pulseOrigin = FixedMath::toQ16(-state.pulseCenter * invWidth);
+        terms.pulseStep = (int32_t)(invWidth / numLeds * 16777216.0f);
     }
 
     // Calculate dreamy pixel value
     CRGB dreamPixel(uint16_t pos) {
-        const float position = (float)pos / numLeds;
-
-        // Three overlapping wave functions
-        const float wave1 = waveA.amplitude *
-            sin(2 * PI * (waveA.frequency * pos + millis() * waveA.speed));
-
-        const float wave2 = waveB.amplitude *
-            sin(2 * PI * (waveB.frequency * pos + millis() * waveB.speed + state.phaseShift));
-
-        const float wave3 = waveC.amplitude *
-            cos(2 * PI * (waveC.frequency * pos + millis() * waveC.speed));
-
-        // Combined waveform value
-        float waveValue = (wave1 + wave2 + wave3) / 3.0;
+        // Three overlapping wave functions, Q15
+        int32_t waveSum = 0;
+        for (uint8_t k = 0; k < 3; k++) {
+            const uint16_t angle = (terms.wavePhase[k] + pos * terms.waveStep[k]) >> 16;
+            waveSum += (terms.waveAmp[k] * FixedMath::sinQ15(angle)) >> 15;
+        }
 
-        // Breathing pulse effect
-        const float pulse = exp(-pow((position - state.pulseCenter) / state.pulseWidth, 2));
+        // Breathing pulse effect, Q16
+        const int32_t pulseX = terms.pulseOrigin + (((int32_t)pos * terms.pulseStep) >> 8);
+        const int32_t pulse = FixedMath::gaussQ16(pulseX);
 
-        // Final position in the color spectrum
-        const float huePosition = fmod(
-            state.hue +
-            state.hueDrift * pos +
-            waveValue * 20 +
-            pulse * 30 +
-            state.energyFlow * 60,
-            256.0
-        );
+        // Final position in the color spectrum, Q16. Waves average to
+        // waveSum / 3 and swing the hue by 20; the pulse adds up to 30.
+        const int32_t huePosition =
+            terms.hueBase +
+            terms.hueDrift * pos +
+            waveSum * 40 / 3 +
+            pulse * 30;
 
         // Get color from smoothly evolving palette
         return ColorFromPalette(
-            currentPalette,
-            (uint8_t)huePosition,
-            200 + 55 * pulse,  // Brighter at pulse center
+            palette,
+            (uint8_t)(huePosition >> 16),
+            200 + ((55 * pulse) >> 16),  // Brighter at pulse center
             LINEARBLEND
         );
     }
 
 public:
     LiquidDreamAnimation(CRGB* ledArray, uint16_t numLeds)
-        : Animation(ledArray, numLeds, "Liquid Dream") {
+        : Animation(ledArray, numLeds, "Liquid Dream"),
+          palette(CRGBPalette16(
+              CHSV(30, 200, 200),
+              CHSV(90, 220, 220),
+              CHSV(160, 180, 180),
+              CHSV(210, 200, 200)
+          )) {
 
         // Initial dream state
         state = {
@@ -179,29 +185,33 @@ public:
         waveB = {0.2, 0.015, -0.00003, 0};
         waveC = {0.15, 0.025, 0.000015, 0};
 
-        // Create initial palette
-        currentPalette = CRGBPalette256(
-            CHSV(30, 200, 200),
-            CHSV(90, 220, 220),
-            CHSV(160, 180, 180),
-            CHSV(210, 200, 200)
-        );
-        targetPalette = currentPalette;
-        paletteBlendProgress = 1.0;
+        // At most a ~90s fade, even between opposite palettes
+        palette.setRate(48, 350);
+
+        // Waves span 20+ pixels, so every 4th pixel carries all the detail
+        enableSubResolution(4);
+        enableKeyframes(KEYFRAME_INTERVAL_MS);
+
+        timers.every(7 * 60000UL, &LiquidDreamAnimation::evolvePalette);
+        timers.every(3 * 60000UL, &LiquidDreamAnimation::reshapeWaves);
     }
 
-    void update() override {
+    void update(const FrameContext& frame) override {
         // Update everything slowly
-        evolveDreamState();
-        evolvePalette();
+        {
+            PROFILE_ZONE("liquid.state");
+            timers.tick(*this, frame);
+            evolveDreamState(frame);
+        }
 
         // Render each pixel with dreamy calculations
-        for(int i = 0; i < numLeds; i++) {
-            leds[i] = dreamPixel(i);
+        {
+            PROFILE_ZONE("liquid.pixels");
+            renderPixels([this](uint16_t i) { return dreamPixel(i); });
         }
 
         // Apply subtle blur for extra smoothness
-        EVERY_N_SECONDS(5) {
+        if (timers.throttle(lastBlur, 5000)) {
             blur1d(leds, numLeds, 32);
         }
     }
@@ -212,40 +222,44 @@ class DreamwaveAuroraAnimation : public Animation {
 private:
     uint16_t x;
     uint16_t scale;
-    CRGBPalette16 currentPalette;
-    CRGBPalette16 targetPalette;
+    PaletteBlend currentPalette;
     uint8_t colorLoop;
     uint8_t brightness;
+    RateAccumulator motionStep;
+    NoiseField field;
+    TimerWheel<DreamwaveAuroraAnimation> timers;
+
+    // Occasionally switch palette; PaletteService fades toward it
+    void pickPalette(const FrameContext&) {
+        switch (random8(4)) {
+            case 0: currentPalette.setTarget(LavaColors_p); break;
+            case 1: currentPalette.setTarget(CloudColors_p); break;
+            case 2: currentPalette.setTarget(OceanColors_p); break;
+            case 3: currentPalette.setTarget(ForestColors_p); break;
+        }
+    }
 
 public:
     DreamwaveAuroraAnimation(CRGB* ledArray, uint16_t numLeds)
-        : Animation(ledArray, numLeds, "Dreamwave Aurora"), x(0), scale(50), colorLoop(0), brightness(180) {
-        currentPalette = PartyColors_p;
-        targetPalette = OceanColors_p;
+        : Animation(ledArray, numLeds, "Dreamwave Aurora"), x(0), scale(50),
+          currentPalette(PartyColors_p), colorLoop(0), brightness(180) {
+        currentPalette.setTarget(OceanColors_p);
+        currentPalette.setRate(4, 100);
+        enableSubResolution(2); // Noise cell is ~5 pixels wide at this scale
+        enableKeyframes(KEYFRAME_INTERVAL_MS);
+        field.configure(numLeds, scale);
+        timers.every(15000, &DreamwaveAuroraAnimation::pickPalette);
     }
 
-    void update() override {
-        // Smooth fade to next palette
-        EVERY_N_MILLISECONDS(100) {
-            nblendPaletteTowardPalette(currentPalette, targetPalette, 4);
-        }
-
-        // Occasionally switch palette
-        EVERY_N_SECONDS(15) {
-            switch (random8(4)) {
-                case 0: targetPalette = LavaColors_p; break;
-                case 1: targetPalette = CloudColors_p; break;
-                case 2: targetPalette = OceanColors_p; break;
-                case 3: targetPalette = ForestColors_p; break;
-            }
-        }
+    void update(const FrameContext& frame) override {
+        timers.tick(*this, frame);
 
         // Fill strip with noise-driven colors
-        for (uint16_t i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * scale, x);
-            uint8_t index = noise + colorLoop;
-            leds[i] = ColorFromPalette(currentPalette, index, brightness);
-        }
+        field.render(0, x);
+        renderPixels([this](uint16_t i) {
+            uint8_t index = field[i] + colorLoop;
+            return ColorFromPalette(currentPalette, index, brightness);
+        });
 
         // Add subtle glitter on top
         if (random8() < 40) {
@@ -253,8 +267,9 @@ public:
         }
 
         // Motion over time
-        x += 1;
-        colorLoop += 1;
+        const uint32_t steps = motionStep.perFrame(frame.deltaMs, 1);
+        x += steps;
+        colorLoop += steps;
     }
 };
 static Registrar<DreamwaveAuroraAnimation> dreamwaveAuroraRegistrar("Dreamwave Aurora");
@@ -265,11 +280,11 @@ private:
 public:
     BreathingAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Breathing"), breath(0) {}
-    void update() override {
+    void update(const FrameContext& frame) override {
         if (!leds || numLeds == 0) return;
-        breath += 0.01;
+        breath += 0.01 * framesElapsed(frame.deltaMs);
         if (breath > TWO_PI) breath = 0;
-        uint8_t breathBrightness = beatsin8(6, MIN_BRIGHTNESS, constrain(brightness, MIN_BRIGHTNESS, MAX_BRIGHTNESS), 0, 0);
+        uint8_t breathBrightness = frame.beatsin8(6, MIN_BRIGHTNESS, constrain(brightness, MIN_BRIGHTNESS, MAX_BRIGHTNESS), 0, 0);
         fill_solid(leds, numLeds, CHSV(140, 150, breathBrightness));
     }
 };
@@ -278,26 +293,24 @@ static Registrar<BreathingAnimation> breathingRegistrar("Breathing");
 class AuroraAnimation : public Animation {
 private:
     uint16_t t;
-    CRGBPalette16 auroraPalette;
+    RateAccumulator tStep;
+    NoiseField field;
 public:
     AuroraAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Aurora"), t(0) {
-        auroraPalette = CRGBPalette16(
-            CRGB(0, 100, 0), CRGB(0, 150, 0), CRGB(0, 200, 0), CRGB(0, 255, 0),
-            CRGB(100, 0, 200), CRGB(150, 0, 255), CRGB(200, 0, 255), CRGB(255, 0, 255),
-            CRGB(0, 50, 150), CRGB(0, 100, 200), CRGB(0, 150, 255), CRGB(0, 200, 255),
-            CRGB(0, 0, 0), CRGB(0, 0, 0), CRGB(0, 0, 0), CRGB(0, 0, 0)
-        );
+        enableSubResolution(4);
+        enableKeyframes(KEYFRAME_INTERVAL_MS);
+        field.configure(numLeds, 20);
     }
-    void update() override {
-        EVERY_N_MILLISECONDS(50) { t++; }
-        fadeToBlackBy(leds, numLeds, 10);
-        for (int i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * 20, t);
-            uint8_t index = map(noise, 0, 255, 0, 255);
+    void update(const FrameContext& frame) override {
+        t += tStep.advance(frame.deltaMs, 1, 50);
+        field.render(0, t);
+        // Every pixel is overwritten below, so no fade pass is needed
+        renderPixels([this](uint16_t i) {
+            uint8_t noise = field[i];
             uint8_t bright = map(sin8(noise), 0, 255, 50, 150);
-            leds[i] = ColorFromPalette(auroraPalette, index, bright, LINEARBLEND);
-        }
+            return ColorFromPalette(Palettes::Aurora_p, noise, bright, LINEARBLEND);
+        });
     }
 };
 static Registrar<AuroraAnimation> auroraRegistrar("Aurora");
@@ -314,20 +327,30 @@ private:
     uint8_t mood;
     unsigned long moodChangeTime;
     uint8_t thunderChance;
+    RateAccumulator hueStep;
+    RateAccumulator fadeStep; // Fade passes, one per nominal frame
+    NoiseField storm;
+    TimerWheel<LavaCyberAuroraStorm> timers;
+    uint32_t lastFlashFade = 0;
+
+    void shiftMood(const FrameContext&) { mood = random8(3); }
 public:
     LavaCyberAuroraStorm(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "LavaCyberAuroraStorm"), gHue(0), noiseScale(20), speed(5), mood(0), moodChangeTime(0), thunderChance(5) {
         lavaPalette = CRGBPalette16(CRGB::Black, CRGB::Red, CRGB::Orange, CRGB::Yellow);
         cyberPalette = CRGBPalette16(CRGB::Black, CRGB::HotPink, CRGB::Purple, CRGB::Cyan);
         auroraPalette = CRGBPalette16(CRGB::Black, CRGB::Green, CRGB::Teal, CRGB::Purple);
+        storm.configure(numLeds, noiseScale);
+        timers.everyRandom(30000, 60000, &LavaCyberAuroraStorm::shiftMood);
     }
-    void update() override {
-        EVERY_N_SECONDS(random8(30, 60)) { mood = random8(3); } // Shift moods
-        EVERY_N_MILLISECONDS(50) { gHue++; }
-        fadeToBlackBy(leds, numLeds, 10); // Smooth fade
+    void update(const FrameContext& frame) override {
+        timers.tick(*this, frame); // Shift moods
+        gHue += hueStep.advance(frame.deltaMs, 1, 50);
+        for (uint32_t n = fadeStep.perFrame(frame.deltaMs, 1); n; n--) fadeToBlackBy(leds, numLeds, 10); // Smooth fade
 
+        storm.render(0, frame.nowMs / speed + gHue);
         for (int i = 0; i < numLeds; i++) {
-            uint8_t noise = inoise8(i * noiseScale, millis() / speed + gHue);
+            uint8_t noise = storm[i];
             uint8_t bright = sin8(noise) / 2; // Low to medium
             CRGB color;
             switch (mood) {
@@ -347,7 +370,7 @@ public:
         // Thunderstorm flash
         if (random8() < thunderChance) {
             fill_solid(leds, numLeds, CRGB::White);
-            EVERY_N_MILLISECONDS(100) { fadeToBlackBy(leds, numLeds, 200); } // Quick flash fade
+            if (timers.throttle(lastFlashFade, 100)) fadeToBlackBy(leds, numLeds, 200); // Quick flash fade
         }
     }
 };
@@ -360,52 +383,56 @@ private:
     uint8_t shootingPos;
     uint8_t shootingBright;
     bool shootingActive;
-    CRGBPalette16 nightPalette;
+    RateAccumulator shootingStep;
+    RateAccumulator fadeStep; // Fade passes, one per nominal frame
+    NoiseField clouds;
+    TimerWheel<MoonlightAnimation> timers;
+
+    // Occasional shooting star
+    void launchShootingStar(const FrameContext&) {
+        if (!shootingActive && random8() < 50) {
+            shootingActive = true;
+            shootingPos = 0;
+            shootingBright = 255;
+            shootingStep.reset();
+        }
+    }
 public:
     MoonlightAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Moonlight"), shootingPos(0), shootingBright(0), shootingActive(false) {
-        nightPalette = CRGBPalette16(
-            CRGB(0, 0, 20), CRGB(0, 0, 40), CRGB(0, 0, 60), CRGB(10, 0, 80),
-            CRGB(20, 0, 100), CRGB(30, 0, 120), CRGB(40, 0, 140), CRGB(50, 0, 160),
-            CRGB(60, 0, 180), CRGB(70, 0, 200), CRGB(80, 0, 220), CRGB(90, 0, 240),
-            CRGB(100, 0, 255), CRGB(120, 20, 255), CRGB(140, 40, 255), CRGB(160, 60, 255)
-        );
         for (uint8_t i = 0; i < 10; i++) {
             starPositions[i] = random16(numLeds);
             starBright[i] = random8(50, 100);
         }
+        clouds.configure(numLeds, 10);
+        timers.every(10000, &MoonlightAnimation::launchShootingStar);
     }
-    void update() override {
-        fadeToBlackBy(leds, numLeds, 5); // Subtle fade
+    void update(const FrameContext& frame) override {
+        for (uint32_t n = fadeStep.perFrame(frame.deltaMs, 1); n; n--) fadeToBlackBy(leds, numLeds, 5); // Subtle fade
 
         // Background noise clouds
+        clouds.render(0, frame.nowMs / 100);
+        uint8_t* bright = Render::gatherScratch();
         for (int i = 0; i < numLeds; i++) {
-            uint8_t index = inoise8(i * 10, millis() / 100);
-            uint8_t bright = qsuba(index, 200); // Low brightness
-            leds[i] = ColorFromPalette(nightPalette, index, bright);
+            bright[i] = qsuba(clouds[i], 200); // Low brightness
         }
+        Render::gatherPalette(leds, Palettes::Night_p, clouds.data(), 0, bright, numLeds);
 
         // Twinkling stars
         for (uint8_t i = 0; i < 10; i++) {
-            starBright[i] = beatsin8(10 + i, 50, 150); // Varying twinkle
+            starBright[i] = frame.beatsin8(10 + i, 50, 150); // Varying twinkle
             leds[starPositions[i]] = CRGB::White;
             leds[starPositions[i]].fadeLightBy(255 - starBright[i]);
         }
 
-        // Occasional shooting star
-        EVERY_N_SECONDS(10) {
-            if (!shootingActive && random8() < 50) {
-                shootingActive = true;
-                shootingPos = 0;
-                shootingBright = 255;
-            }
-        }
+        timers.tick(*this, frame);
         if (shootingActive) {
             if (shootingPos < numLeds) {
                 leds[shootingPos] = CRGB::White;
                 leds[shootingPos].fadeLightBy(255 - shootingBright);
-                shootingPos += 2; // Speed
-                shootingBright -= 20; // Fade tail
+                const uint32_t steps = shootingStep.perFrame(frame.deltaMs, 1);
+                shootingPos += 2 * steps; // Speed
+                shootingBright -= 20 * steps; // Fade tail
             } else {
                 shootingActive = false;
             }
@@ -417,15 +444,22 @@ static Registrar<MoonlightAnimation> moonlightRegistrar("Moonlight");
 class ForestCanopyAnimation : public Animation {
 private:
     uint16_t t;
+    RateAccumulator tStep;
+    NoiseField greenField;
+    NoiseField blueField;
 public:
     ForestCanopyAnimation(CRGB* ledArray, uint16_t numLeds)
-        : Animation(ledArray, numLeds, "Forest Canopy"), t(0) {}
-    void update() override {
-        t += 5;
+        : Animation(ledArray, numLeds, "Forest Canopy"), t(0) {
+        enableKeyframes(KEYFRAME_INTERVAL_MS);
+        greenField.configure(numLeds, 20);
+        blueField.configure(numLeds, 20);
+    }
+    void update(const FrameContext& frame) override {
+        t += tStep.perFrame(frame.deltaMs, 5);
+        greenField.render(0, t);
+        blueField.render(10000, t);
         for (int i = 0; i < numLeds; i++) {
-            uint8_t green = inoise8(i * 20, t);
-            uint8_t blue = inoise8(i * 20 + 10000, t);
-            leds[i] = CRGB(0, green/2, blue/3);
+            leds[i] = CRGB(0, greenField[i] / 2, blueField[i] / 3);
         }
         fadeLightBy(leds, numLeds, 5);
     }
@@ -435,15 +469,19 @@ static Registrar<ForestCanopyAnimation> forestCanopyRegistrar("Forest Canopy");
 class GentlePulseWaveAnimation : public Animation {
 private:
     uint8_t gHue;
+    RateAccumulator hueStep;
+    CometTrails wave;
 public:
     GentlePulseWaveAnimation(CRGB* ledArray, uint16_t numLeds)
-        : Animation(ledArray, numLeds, "Gentle Pulse Wave"), gHue(0) {}
-    void update() override {
-        EVERY_N_MILLISECONDS(235) { gHue++; }
-        fadeToBlackBy(leds, numLeds, 20);
-        uint8_t pos = beatsin8(5, 0, numLeds - 1);
-        uint8_t brightness = beatsin8(10, 50, 150);
-        leds[pos] = CHSV(gHue, 200, brightness);
+        : Animation(ledArray, numLeds, "Gentle Pulse Wave"), gHue(0) {
+        wave.configure(numLeds, 20);
+    }
+    void update(const FrameContext& frame) override {
+        gHue += hueStep.advance(frame.deltaMs, 1, 235);
+        wave.advance(frame.deltaMs);
+        uint8_t pulse = frame.beatsin8(10, 50, 150);
+        wave.moveTo(0, CometTrails::sweep(frame.beatsin16(5), numLeds), CHSV(gHue, 200, pulse));
+        wave.render(leds);
     }
 };
 static Registrar<GentlePulseWaveAnimation> gentlePulseWaveRegistrar("Gentle Pulse Wave");
@@ -451,23 +489,26 @@ static Registrar<GentlePulseWaveAnimation> gentlePulseWaveRegistrar("Gentle Puls
 class TwilightRippleAnimation : public Animation {
 private:
     uint8_t gHue;
-    CRGBPalette16 currentPalette;
+    RateAccumulator hueStep;
+    NoiseField hueField;
+    NoiseField brightField;
 public:
     TwilightRippleAnimation(CRGB* ledArray, uint16_t numLeds)
-        : Animation(ledArray, numLeds, "Twilight Ripple"), gHue(0),
-          currentPalette(CRGBPalette16(
-              CRGB::Blue, CRGB::Purple, CRGB(0, 128, 128), CRGB(0, 100, 0),
-              CRGB(0, 0, 128), CRGB(75, 0, 130), CRGB::Cyan, CRGB(34, 139, 34),
-              CRGB::Blue, CRGB::Purple, CRGB(0, 128, 128), CRGB(0, 100, 0),
-              CRGB(0, 0, 128), CRGB(75, 0, 130), CRGB::Cyan, CRGB(34, 139, 34))) {}
-    void update() override {
-        EVERY_N_MILLISECONDS(235) { gHue++; }
-        fadeToBlackBy(leds, numLeds, 10);
-        for (uint16_t i = 0; i < numLeds; i++) {
-            uint8_t index = inoise8(i * 20, millis() / 50) + gHue;
-            uint8_t brightness = qsuba(inoise8(i * 10, millis() / 40), 100);
-            leds[i] = ColorFromPalette(currentPalette, index, brightness);
-        }
+        : Animation(ledArray, numLeds, "Twilight Ripple"), gHue(0) {
+        enableSubResolution(4);
+        enableKeyframes(KEYFRAME_INTERVAL_MS);
+        hueField.configure(numLeds, 20);
+        brightField.configure(numLeds, 10);
+    }
+    void update(const FrameContext& frame) override {
+        gHue += hueStep.advance(frame.deltaMs, 1, 235);
+        hueField.render(0, frame.nowMs / 50);
+        brightField.render(0, frame.nowMs / 40);
+        renderPixels([this](uint16_t i) {
+            uint8_t index = hueField[i] + gHue;
+            uint8_t brightness = qsuba(brightField[i], 100);
+            return ColorFromPalette(Palettes::Twilight_p, index, brightness);
+        });
     }
 };
 static Registrar<TwilightRippleAnimation> twilightRippleRegistrar("Twilight Ripple");
@@ -475,23 +516,27 @@ static Registrar<TwilightRippleAnimation> twilightRippleRegistrar("Twilight Ripp
 class StarlitDriftAnimation : public Animation {
 private:
     uint8_t gHue;
-    CRGBPalette16 currentPalette;
+    RateAccumulator hueStep;
+    RateAccumulator starStep;
+    SparkleField stars;
 public:
     StarlitDriftAnimation(CRGB* ledArray, uint16_t numLeds)
-        : Animation(ledArray, numLeds, "Starlit Drift"), gHue(0),
-          currentPalette(CRGBPalette16(
-              CRGB::Blue, CRGB::Purple, CRGB(70, 130, 180), CRGB(200, 255, 255),
-              CRGB(0, 0, 128), CRGB(75, 0, 130), CRGB(135, 206, 235), CRGB::Gray,
-              CRGB::Blue, CRGB::Purple, CRGB(70, 130, 180), CRGB(200, 255, 255),
-              CRGB(0, 0, 128), CRGB(75, 0, 130), CRGB(135, 206, 235), CRGB::Gray)) {}
-    void update() override {
-        EVERY_N_MILLISECONDS(235) { gHue++; }
-        fadeToBlackBy(leds, numLeds, 15);
-        if (random8() < 20) {
-            uint16_t pos = random16(numLeds);
-            uint8_t brightness = beatsin8(8, 80, 120);
-            leds[pos] = ColorFromPalette(currentPalette, gHue + random8(20), brightness);
+        : Animation(ledArray, numLeds, "Starlit Drift"), gHue(0) {
+        // The original per-frame fadeToBlackBy(leds, numLeds, 15)
+        stars.configure(numLeds, 15);
+    }
+    void update(const FrameContext& frame) override {
+        gHue += hueStep.advance(frame.deltaMs, 1, 235);
+        stars.update(frame.deltaMs);
+        // About five new stars a second, as the old 20/256 chance per frame
+        const uint8_t brightness = frame.beatsin8(8, 80, 120);
+        for (uint32_t n = starStep.advance(frame.deltaMs, 5, 1000); n > 0; n--) {
+            stars.light(random16(numLeds), ColorFromPalette(Palettes::Starlit_p, gHue + random8(20), brightness));
         }
+        stars.render(leds);
+    }
+    bool changedPixels(const uint16_t*& list, uint16_t& count) const override {
+        return stars.changed(list, count);
     }
 };
 static Registrar<StarlitDriftAnimation> starlitDriftRegistrar("Starlit Drift");
@@ -503,29 +548,38 @@ private:
     uint16_t noiseX;           // X coord for noise field
     uint16_t noiseY;           // Y coord for noise field (time-based)
     uint8_t pulseBeat;         // Precomputed pulse for efficiency
+    RateAccumulator driftStep;     // Hue and noiseY drift, every 30ms
+    RateAccumulator noiseXStep;    // noiseX drift, every 50ms
     CRGBPalette16 currentPalette;  // Fixed palette, morphed in-place
+    CRGB targetColor;              // Evolving target
+    TimerWheel<EtherealPlasmaDrift> timers;
+
+    // Morph palette subtly for non-repetition (in-place, no alloc)
+    void morphPalette(const FrameContext&) {
+        for (uint8_t i = 0; i < 16; i++) {
+            nblend(currentPalette[i], targetColor, 8);
+        }
+        targetColor = CHSV(gHue + random8(64), 180 + random8(76), 150 + random8(106));
+    }
 
 public:
     EtherealPlasmaDrift(CRGB* ledArray, uint16_t numLeds)
-        : Animation(ledArray, numLeds, "Ethereal Plasma Drift") {
+        : Animation(ledArray, numLeds, "Ethereal Plasma Drift"), gHue(0), noiseX(0), noiseY(0), pulseBeat(0),
+          targetColor(CHSV(128, 180, 200)) {
         // Init palette to soft blues/purples for start
         fill_gradient(currentPalette.entries, 16, CHSV(160, 255, 255), CHSV(220, 200, 180), fl::LONGEST_HUES);
+        enableKeyframes(KEYFRAME_INTERVAL_MS);
+        timers.every(100, &EtherealPlasmaDrift::morphPalette);
     }
 
-    void update() override {
+    void update(const FrameContext& frame) override {
         // Efficient timing: Increment counters once
-        EVERY_N_MILLISECONDS(30) { gHue++; noiseY += 2; }  // Slow evolution
-        EVERY_N_MILLISECONDS(50) { noiseX++; }             // Asymmetric noise motion
-        pulseBeat = beatsin8(5, 64, 192);                  // Gentle pulse, precompute
-
-        // Morph palette subtly for non-repetition (in-place, no alloc)
-        static CRGB targetColor = CHSV(gHue + 128, 180, 200);  // Evolving target
-        EVERY_N_MILLISECONDS(100) {
-            for (uint8_t i = 0; i < 16; i++) {
-                nblend(currentPalette[i], targetColor, 8);
-            }
-            targetColor = CHSV(gHue + random8(64), 180 + random8(76), 150 + random8(106));
-        }
+        const uint32_t drift = driftStep.advance(frame.deltaMs, 1, 30);
+        gHue += drift; noiseY += 2 * drift;                // Slow evolution
+        noiseX += noiseXStep.advance(frame.deltaMs, 1, 50);      // Asymmetric noise motion
+        pulseBeat = frame.beatsin8(5, 64, 192);                  // Gentle pulse, precompute
+
+        timers.tick(*this, frame); // Palette morph
 
         // Core plasma: Perlin noise mapped to palette, O(N) loop
         for (uint16_t i = 0; i < numLeds; i++) {
@@ -547,4 +601,27 @@ public:
     }
 };
 
-static Registrar<EtherealPlasmaDrift> etherealPlasmaDriftRegistrator("Ethereal Plasma Drift");
\ No newline at end of file
+static Registrar<EtherealPlasmaDrift> etherealPlasmaDriftRegistrator("Ethereal Plasma Drift");
+
+
+class RainRipplesAnimation : public Animation {
+private:
+    RateAccumulator rain;
+    RippleField water;
+public:
+    RainRipplesAnimation(CRGB* ledArray, uint16_t numLeds)
+        : Animation(ledArray, numLeds, "Rain Ripples") {
+        water.configure(numLeds);
+        water.setDamping(252);
+    }
+    void update(const FrameContext& frame) override {
+        // Light rain, a drop per 10 LEDs every ten seconds, and a big splash on a button hit
+        for (uint32_t n = rain.advance(frame.deltaMs, numLeds / 10 + 1, 10000); n > 0; n--) {
+            water.drop(random16(numLeds), random16(RippleField::FULL_SCALE / 4, RippleField::FULL_SCALE), random8(1, 3));
+        }
+        if (frame.onTrigger) water.drop(random16(numLeds), RippleField::FULL_SCALE * 2, 6);
+        water.update(frame.deltaMs);
+        water.render(leds, OceanColors_p, brightness);
+    }
+};
+static Registrar<RainRipplesAnimation> rainRipplesRegistrar("Rain Ripples");
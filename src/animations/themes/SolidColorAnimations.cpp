@@ -11,7 +11,7 @@ private:
 public:
     RedPurpleBlueAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Red Purple Blue -NoShuffle"), hue(255) {}
-    void update() override {
+    void update(const FrameContext&) override {
         hue = colorModifier;
         fill_solid(leds, numLeds, CRGB(hue, 0, 255-hue));
     }
@@ -24,7 +24,7 @@ private:
 public:
     GreenYellowRedAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Green Yellow Red -NoShuffle"), hue(255) {}
-    void update() override {
+    void update(const FrameContext&) override {
         hue = colorModifier;
         fill_solid(leds, numLeds, CRGB(255-hue, hue, 0));
     }
@@ -37,7 +37,7 @@ private:
 public:
     GreenBlueAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Green Blue -NoShuffle"), hue(255) {}
-    void update() override {
+    void update(const FrameContext&) override {
         hue = colorModifier;
         fill_solid(leds, numLeds, CRGB(0, 255-hue, hue));
     }
@@ -48,7 +48,7 @@ class OrangeAnimation : public Animation {
 public:
     OrangeAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Orange") {}
-    void update() override {
+    void update(const FrameContext&) override {
         fill_solid(leds, numLeds, CRGB(255, 100, 0));
     }
 };
@@ -58,7 +58,7 @@ class PurpleAnimation : public Animation {
 public:
     PurpleAnimation(CRGB* ledArray, uint16_t numLeds)
         : Animation(ledArray, numLeds, "Purple -NoShuffle") {}
-    void update() override {
+    void update(const FrameContext&) override {
         fill_solid(leds, numLeds, CRGB(255, 0, 255));
     }
 };
@@ -11,6 +11,16 @@
 #define ENABLE_SAFE_MODE 1
 #define MAX_MILLIAMPS 10000 // Support 300 LEDs (~10A max)
 #define ENABLE_OLED 1
+#define ENABLE_BENCHMARKS 0 // Print render benchmarks over Serial at boot
+#define ENABLE_GOLDEN_FRAMES 0 // Check every animation's output against the approved hashes at boot
+#define ENABLE_SOAK 0 // Simulate days of use at boot and report heap churn over Serial
+#define SOAK_VIRTUAL_HOURS 72
+#define ENABLE_FRAME_EXPORT 0 // Accept frame export commands over Serial (tools/export_frames.py)
+#define ENABLE_PROFILER 0 // Record PROFILE_ZONE timings; dump with the "profile" Serial command
+#define PROFILER_RING_SIZE 512
+#define ENABLE_TELEMETRY 0 // Binary status records over Serial instead of status lines (tools/decode_telemetry.py)
+#define TELEMETRY_INTERVAL_MS 1000
+#define ENABLE_STATUS_LOGS (!ENABLE_TELEMETRY) // Periodic human-readable status lines
 
 #if ENABLE_OLED
 #include <U8g2lib.h>
@@ -25,6 +35,7 @@
 #define BUILTIN_LED_PIN 2
 #define ADJUST_NUM_LEDS_INCREMENT 50
 #define ADJUST_BRIGHTNESS_INCREMENT 25
+#define DOUBLE_CLICK_WINDOW_MS 250 // Single clicks wait this long to rule out a double click
 
 #define MIN_BRIGHTNESS 25
 #define MAX_BRIGHTNESS 255
@@ -32,6 +43,12 @@
 
 #define TARGET_FPS 60
 #define ANIMATION_UPDATE_INTERVAL (1000 / TARGET_FPS)
+#define MAX_FRAME_DELTA_MS 100 // Longest step handed to Animation::update() after a stall
+#define DEFAULT_TEMPO_BPM 120 // Shared beat clock the beat-driven animations lock to
+#define KEYFRAME_INTERVAL_MS 50 // 20 Hz keyframes for slow themes, interpolated up to TARGET_FPS
+#define PALETTE_POOL_SIZE 8 // Shared runtime palettes (48 bytes each)
+#define PALETTE_BLEND_BUDGET 32 // Palette entries PaletteService::tick() may blend per frame
+#define HUE_RAMP_SLOTS 3 // Cached CHSV hue ramps for the HSV span kernels (768 bytes each)
 #define HUE_UPDATE_INTERVAL 20
 #define BRIGHTNESS_DISPLAY_DURATION 3000
 #define NUMLEDS_DISPLAY_DURATION 3000
@@ -7,6 +7,7 @@
 #include <FastLED.h>
 #include "../config/Config.h"
 #include "../config/PinConfig.h"
+#include "../diagnostics/Profiler.h"
 
 // Initialize static instance pointer
 InputManager* InputManager::instance = nullptr;
@@ -22,6 +23,10 @@ void InputManager::onClickHandler() {
     }
 }
 
+void InputManager::onDoubleClickHandler() {
+    if (instance) instance->handleDoubleClick();
+}
+
 void InputManager::onLongPressStartHandler() {
     if (instance) instance->handleLongPressStart();
 }
@@ -54,14 +59,19 @@ void InputManager::begin(SystemManager* sysManager) {
     
     // Setup button with callbacks
     button.attachClick(onClickHandler);
+    button.attachDoubleClick(onDoubleClickHandler);
     button.attachLongPressStart(onLongPressStartHandler);
     button.attachLongPressStop(onLongPressStopHandler);
     button.setPressMs(1000);  // Long press detected after 1 second (recommended API)
+    // With a double-click handler attached, every single click waits out this
+    // window; OneButton's 400ms default made pattern changes feel sluggish
+    button.setClickMs(DOUBLE_CLICK_WINDOW_MS);
 
     Serial.println(F("InputManager ready..."));
 }
 
 void InputManager::update() {
+    PROFILE_ZONE("input.update");
     // Update button state
     button.tick();
     
@@ -82,6 +92,14 @@ void InputManager::handleClick() {
     systemManager->handleNextPattern();
 }
 
+void InputManager::handleDoubleClick() {
+    if (systemManager == nullptr) {
+        Serial.println(F("ERROR: systemManager is null in handleDoubleClick"));
+        return;
+    }
+    systemManager->handleTrigger();
+}
+
 bool InputManager::isBrightnessMode() {
     return brightnessMode;
 }
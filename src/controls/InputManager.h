@@ -50,11 +50,15 @@ private:
     
     // Callback functions for button events
     static void onClickHandler();
+    static void onDoubleClickHandler();
     static void onLongPressStartHandler();
     static void onLongPressStopHandler();
     
     // Handle button click
     void handleClick();
+
+    // Handle double click: a hit for animations that react to it
+    void handleDoubleClick();
     
     // Handle long press start
     void handleLongPressStart();
@@ -0,0 +1,903 @@
+/**
+ * Render Benchmarks Implementation
+ *
+ * Every result is printed as one JSON object per line, prefixed with
+ * "[BENCH] " so it can be grepped out of a normal serial log.
+ */
+#include "Benchmarks.h"
+#include <FastLED.h>
+#include <algorithm>
+#include "../animations/AnimationBase.h"
+#include "../config/Config.h"
+#include "../utils/FixedMath.h"
+
+namespace {
+
+const uint16_t BENCH_LED_COUNTS[] = {300, 1000};
+const uint8_t BENCH_FRAMES = 50;
+
+const AnimationInfo* findAnimation(const char* name) {
+    for (const AnimationInfo& info : globalAnimationRegistry) {
+        if (strcmp(info.name, name) == 0) return &info;
+    }
+    return nullptr;
+}
+
+// Virtual clock: frame f at a steady ANIMATION_UPDATE_INTERVAL, independent of
+// how long the benchmark itself takes
+FrameContext benchFrame(uint32_t f, TempoClock& tempo) {
+    FrameContext frame;
+    frame.nowMs = f * ANIMATION_UPDATE_INTERVAL;
+    frame.deltaMs = ANIMATION_UPDATE_INTERVAL;
+    frame.frameCount = f;
+    tempo.advance(frame);
+    return frame;
+}
+
+// Repeats per timed sample in the primitives suite, so short calls rise
+// well above the 1us timer resolution
+const uint8_t PRIMITIVE_REPEATS = 8;
+
+// Results land here so the compiler can't drop the work being timed
+volatile uint32_t benchSink;
+
+// Times body(f) for f in 0..BENCH_FRAMES-1 and prints the median and the
+// best call in ns. Medians and minimums barely move between runs, so two
+// logs can be compared line by line (tools/compare_bench.py).
+template <typename Body>
+void timePrimitive(const char* prim, const char* variant, uint16_t elements, Body body) {
+    uint32_t samples[BENCH_FRAMES];
+    for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+        const uint32_t start = micros();
+        for (uint8_t r = 0; r < PRIMITIVE_REPEATS; r++) body(f);
+        samples[f] = micros() - start;
+        yield();
+    }
+    std::sort(samples, samples + BENCH_FRAMES);
+    const uint32_t median = samples[BENCH_FRAMES / 2] * 1000UL / PRIMITIVE_REPEATS;
+    const uint32_t best = samples[0] * 1000UL / PRIMITIVE_REPEATS;
+
+    Serial.print(F("[BENCH] {\"suite\":\"primitives\",\"prim\":\"")); Serial.print(prim);
+    Serial.print(F("\",\"variant\":\"")); Serial.print(variant);
+    Serial.print(F("\",\"elements\":")); Serial.print(elements);
+    Serial.print(F(",\"ns_median\":")); Serial.print(median);
+    Serial.print(F(",\"ns_min\":")); Serial.print(best);
+    Serial.print(F(",\"ns_per_element\":")); Serial.print(elements ? median / elements : 0);
+    Serial.println(F("}"));
+}
+
+// Runs one frame with a fixed random state so two instances see the same dice rolls
+uint32_t timedFrame(Animation* anim, const FrameContext& frame, uint16_t seed) {
+    anim->setRandomState(seed);
+    uint32_t start = micros();
+    anim->renderFrame(frame);
+    return micros() - start;
+}
+
+// Generations compared cell by cell against a one-byte-per-cell model
+const uint8_t AUTOMATA_CHECKED_GENERATIONS = 50;
+// Ring sizes on and off the 32-cell word boundary, so both the whole-word
+// and the partial-word ring wrap are checked
+const uint16_t AUTOMATA_CHECKED_COUNTS[] = {256, 300, 320, 1000};
+
+uint32_t checkElementary(uint16_t count, uint8_t rule) {
+    random16_set_seed(4242);
+    ElementaryAutomaton engine;
+    engine.configure(count);
+    engine.setRule(rule);
+    engine.seedRandom();
+    std::vector<uint8_t> cells(count), next(count);
+    for (uint16_t i = 0; i < count; i++) cells[i] = engine.alive(i);
+
+    uint32_t mismatches = 0;
+    for (uint8_t g = 0; g < AUTOMATA_CHECKED_GENERATIONS; g++) {
+        for (uint16_t i = 0; i < count; i++) {
+            const uint8_t l = cells[(i + count - 1) % count], c = cells[i], r = cells[(i + 1) % count];
+            next[i] = rule >> (l << 2 | c << 1 | r) & 1;
+        }
+        cells.swap(next);
+        engine.step();
+        for (uint16_t i = 0; i < count; i++) mismatches += engine.alive(i) != cells[i];
+    }
+    return mismatches;
+}
+
+uint32_t checkCyclic(uint16_t count, uint8_t stateBits) {
+    random16_set_seed(4242);
+    CyclicAutomaton engine;
+    engine.configure(count, stateBits);
+    engine.seedRandom();
+    const uint8_t states = engine.states();
+    std::vector<uint8_t> cells(count), next(count);
+    for (uint16_t i = 0; i < count; i++) cells[i] = engine.state(i);
+
+    uint32_t mismatches = 0;
+    for (uint8_t g = 0; g < AUTOMATA_CHECKED_GENERATIONS; g++) {
+        for (uint16_t i = 0; i < count; i++) {
+            const uint8_t succ = (cells[i] + 1) % states;
+            const bool advance = cells[(i + count - 1) % count] == succ || cells[(i + 1) % count] == succ;
+            next[i] = advance ? succ : cells[i];
+        }
+        cells.swap(next);
+        engine.step();
+        for (uint16_t i = 0; i < count; i++) mismatches += engine.state(i) != cells[i];
+    }
+    return mismatches;
+}
+
+} // namespace
+
+namespace Benchmarks {
+
+void runAll() {
+    Serial.println(F("=== Benchmarks start ==="));
+    runSubResolution();
+    runFixedMath();
+    runNoiseField();
+    runPalettes();
+    runPaletteGather();
+    runHsvKernels();
+    runParticles();
+    runHeatField();
+    runWaves();
+    runComets();
+    runSparkles();
+    runAutomata();
+    runPrimitives();
+    Serial.println(F("=== Benchmarks done ==="));
+}
+
+void runSubResolution() {
+    static const char* const names[] = {"Aurora", "Dreamwave Aurora", "Twilight Ripple", "Liquid Dream"};
+
+    CRGB* fullBuf = new CRGB[MAX_LEDS];
+    CRGB* subBuf = new CRGB[MAX_LEDS];
+
+    for (const char* name : names) {
+        const AnimationInfo* info = findAnimation(name);
+        if (!info) {
+            Serial.print(F("[BENCH] missing animation: ")); Serial.println(name);
+            continue;
+        }
+        for (uint16_t count : BENCH_LED_COUNTS) {
+            fill_solid(fullBuf, MAX_LEDS, CRGB::Black);
+            fill_solid(subBuf, MAX_LEDS, CRGB::Black);
+            Animation* full = info->createFn(fullBuf, count);
+            Animation* sub = info->createFn(subBuf, count);
+            const uint8_t stride = sub->getRenderStride();
+            full->setRenderStride(1);
+
+            uint32_t fullMicros = 0, subMicros = 0;
+            uint64_t absError = 0;
+            uint8_t maxError = 0;
+            TempoClock tempo;
+            for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+                const uint16_t seed = 1337 + f;
+                const FrameContext frame = benchFrame(f, tempo);
+                fullMicros += timedFrame(full, frame, seed);
+                subMicros += timedFrame(sub, frame, seed);
+                for (uint16_t i = 0; i < count; i++) {
+                    for (uint8_t c = 0; c < 3; c++) {
+                        uint8_t a = fullBuf[i][c], b = subBuf[i][c];
+                        uint8_t diff = a > b ? a - b : b - a;
+                        absError += diff;
+                        if (diff > maxError) maxError = diff;
+                    }
+                }
+                yield();
+            }
+            delete full;
+            delete sub;
+
+            // Mean absolute error per channel, 0-255 scale
+            float mae = (float)absError / ((uint32_t)count * 3 * BENCH_FRAMES);
+            Serial.print(F("[BENCH] {\"suite\":\"subres\",\"anim\":\"")); Serial.print(name);
+            Serial.print(F("\",\"leds\":")); Serial.print(count);
+            Serial.print(F(",\"stride\":")); Serial.print(stride);
+            Serial.print(F(",\"us_full\":")); Serial.print(fullMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_sub\":")); Serial.print(subMicros / BENCH_FRAMES);
+            Serial.print(F(",\"speedup\":")); Serial.print(subMicros ? (float)fullMicros / subMicros : 0.0f, 2);
+            Serial.print(F(",\"mae\":")); Serial.print(mae, 3);
+            Serial.print(F(",\"max_err\":")); Serial.print(maxError);
+            Serial.println(F("}"));
+        }
+    }
+
+    delete[] fullBuf;
+    delete[] subBuf;
+}
+
+void runFixedMath() {
+    const uint16_t samples = 4096;
+    volatile float floatSink = 0;
+    volatile int32_t fixedSink = 0;
+
+    // sin over one full turn
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < samples; i++) floatSink = floatSink + sinf(i * (2 * PI / samples));
+    const uint32_t sinLibm = micros() - start;
+    start = micros();
+    for (uint16_t i = 0; i < samples; i++) fixedSink = fixedSink + FixedMath::sinQ15(i * (65536 / samples));
+    const uint32_t sinFixed = micros() - start;
+    float sinError = 0;
+    for (uint16_t i = 0; i < samples; i++) {
+        float err = fabsf(FixedMath::sinQ15(i * (65536 / samples)) / 32767.0f - sinf(i * (2 * PI / samples)));
+        if (err > sinError) sinError = err;
+    }
+
+    // exp(-x^2) over x in [-4, 4)
+    start = micros();
+    for (uint16_t i = 0; i < samples; i++) {
+        const float x = (i - samples / 2) * (8.0f / samples);
+        floatSink = floatSink + expf(-x * x);
+    }
+    const uint32_t gaussLibm = micros() - start;
+    start = micros();
+    for (uint16_t i = 0; i < samples; i++) fixedSink = fixedSink + FixedMath::gaussQ16((i - samples / 2) * (8 * FixedMath::Q16_ONE / samples));
+    const uint32_t gaussFixed = micros() - start;
+    float gaussError = 0;
+    for (uint16_t i = 0; i < samples; i++) {
+        const float x = (i - samples / 2) * (8.0f / samples);
+        float err = fabsf(FixedMath::gaussQ16((i - samples / 2) * (8 * FixedMath::Q16_ONE / samples)) / 65536.0f - expf(-x * x));
+        if (err > gaussError) gaussError = err;
+    }
+
+    // Signed wraparound, as in wormhole positions
+    start = micros();
+    for (uint16_t i = 0; i < samples; i++) floatSink = floatSink + fmodf(i * 0.37f - 700.0f, 350.0f);
+    const uint32_t wrapLibm = micros() - start;
+    start = micros();
+    for (uint16_t i = 0; i < samples; i++) fixedSink = fixedSink + FixedMath::wrap(i * 24248 - (700L << 16), 350L << 16);
+    const uint32_t wrapFixed = micros() - start;
+
+    const char* const names[] = {"sin", "gauss", "wrap"};
+    const uint32_t libm[] = {sinLibm, gaussLibm, wrapLibm};
+    const uint32_t fixed[] = {sinFixed, gaussFixed, wrapFixed};
+    const float errors[] = {sinError, gaussError, 0.0f};
+    for (uint8_t k = 0; k < 3; k++) {
+        Serial.print(F("[BENCH] {\"suite\":\"fixedmath\",\"fn\":\"")); Serial.print(names[k]);
+        Serial.print(F("\",\"samples\":")); Serial.print(samples);
+        Serial.print(F(",\"us_libm\":")); Serial.print(libm[k]);
+        Serial.print(F(",\"us_fixed\":")); Serial.print(fixed[k]);
+        Serial.print(F(",\"speedup\":")); Serial.print(fixed[k] ? (float)libm[k] / fixed[k] : 0.0f, 2);
+        Serial.print(F(",\"max_err\":")); Serial.print(errors[k], 5);
+        Serial.println(F("}"));
+    }
+}
+
+void runNoiseField() {
+    static const uint16_t scales[] = {15, 50};
+    static const uint8_t octaveCounts[] = {1, 3};
+    uint8_t* direct = new uint8_t[MAX_LEDS];
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        for (uint16_t scale : scales) {
+            for (uint8_t octaves : octaveCounts) {
+                NoiseField field;
+                field.configure(count, scale, octaves);
+                uint32_t directMicros = 0, fieldMicros = 0;
+                uint64_t absError = 0;
+                uint8_t maxError = 0;
+                uint16_t origin = 0, z = 0;
+                for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+                    origin += 2; // Typical per-frame drift of the themes
+                    z += 3;
+                    uint32_t start = micros();
+                    for (uint16_t i = 0; i < count; i++) direct[i] = field.exact(origin + i * scale, z);
+                    directMicros += micros() - start;
+                    start = micros();
+                    field.render(origin, z);
+                    fieldMicros += micros() - start;
+                    for (uint16_t i = 0; i < count; i++) {
+                        uint8_t diff = abs((int)direct[i] - field[i]);
+                        absError += diff;
+                        if (diff > maxError) maxError = diff;
+                    }
+                    yield();
+                }
+
+                Serial.print(F("[BENCH] {\"suite\":\"noise\",\"leds\":")); Serial.print(count);
+                Serial.print(F(",\"scale\":")); Serial.print(scale);
+                Serial.print(F(",\"octaves\":")); Serial.print(octaves);
+                Serial.print(F(",\"us_inoise8\":")); Serial.print(directMicros / BENCH_FRAMES);
+                Serial.print(F(",\"us_field\":")); Serial.print(fieldMicros / BENCH_FRAMES);
+                Serial.print(F(",\"speedup\":")); Serial.print(fieldMicros ? (float)directMicros / fieldMicros : 0.0f, 2);
+                Serial.print(F(",\"mae\":")); Serial.print((float)absError / ((uint32_t)count * BENCH_FRAMES), 3);
+                Serial.print(F(",\"max_err\":")); Serial.print(maxError);
+                Serial.println(F("}"));
+            }
+        }
+    }
+
+    delete[] direct;
+}
+
+void runPalettes() {
+    static const uint8_t blendCounts[] = {1, 4, 8};
+    static const TProgmemRGBPalette16* const targets[] = {&LavaColors_p, &OceanColors_p, &ForestColors_p, &PartyColors_p};
+
+    for (uint8_t count : blendCounts) {
+        // Service: every blend fading at once, the worst case for a frame
+        PaletteBlend* blends[8];
+        for (uint8_t b = 0; b < count; b++) {
+            blends[b] = new PaletteBlend(RainbowColors_p);
+            blends[b]->setTarget(*targets[b % 4]);
+            blends[b]->setRate(48, ANIMATION_UPDATE_INTERVAL);
+        }
+        uint32_t serviceMicros = 0;
+        for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+            const uint32_t start = micros();
+            PaletteService::tick(ANIMATION_UPDATE_INTERVAL);
+            serviceMicros += micros() - start;
+        }
+        for (uint8_t b = 0; b < count; b++) delete blends[b];
+
+        // Baseline: each animation blending its whole palette in its own update()
+        CRGBPalette16* palettes = new CRGBPalette16[count];
+        uint32_t nblendMicros = 0;
+        for (uint8_t b = 0; b < count; b++) palettes[b] = RainbowColors_p;
+        for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+            const uint32_t start = micros();
+            for (uint8_t b = 0; b < count; b++) {
+                CRGBPalette16 target = *targets[b % 4];
+                nblendPaletteTowardPalette(palettes[b], target, 48);
+            }
+            nblendMicros += micros() - start;
+        }
+        delete[] palettes;
+
+        Serial.print(F("[BENCH] {\"suite\":\"palette\",\"blends\":")); Serial.print(count);
+        Serial.print(F(",\"us_nblend\":")); Serial.print(nblendMicros / BENCH_FRAMES);
+        Serial.print(F(",\"us_service\":")); Serial.print(serviceMicros / BENCH_FRAMES);
+        Serial.print(F(",\"budget\":")); Serial.print(PALETTE_BLEND_BUDGET);
+        Serial.println(F("}"));
+        yield();
+    }
+
+    // Memory: handles to one HSV palette share a slot, flash palettes cost no RAM
+    {
+        SharedPalette a = SharedPalette::fromHsv(Palettes::SOFT_FLAME);
+        SharedPalette b = SharedPalette::fromHsv(Palettes::SOFT_FLAME);
+        SharedPalette c = a;
+        const PaletteService::Stats stats = PaletteService::stats();
+        const uint8_t flashPalettes = 6; // Palettes::*_p that used to be per-instance members
+        const int32_t liquidDreamSaved = 2 * (int32_t)sizeof(CRGBPalette256) - (int32_t)sizeof(PaletteBlend);
+        Serial.print(F("[BENCH] {\"suite\":\"palette_mem\",\"shared_slots\":")); Serial.print(stats.sharedSlots);
+        Serial.print(F(",\"shared_refs\":")); Serial.print(stats.sharedRefs);
+        Serial.print(F(",\"bytes_shared\":")); Serial.print(stats.bytesShared);
+        Serial.print(F(",\"bytes_flash\":")); Serial.print(flashPalettes * sizeof(CRGBPalette16));
+        Serial.print(F(",\"bytes_liquid_dream\":")); Serial.print(liquidDreamSaved);
+        Serial.println(F("}"));
+    }
+}
+
+void runPaletteGather() {
+    CRGB* reference = new CRGB[MAX_LEDS];
+    CRGB* gathered = new CRGB[MAX_LEDS];
+    uint8_t* indices = new uint8_t[MAX_LEDS];
+    uint8_t* bright = new uint8_t[MAX_LEDS];
+    ExpandedPalette* expanded = new ExpandedPalette();
+    const CRGBPalette16 palette = PartyColors_p;
+
+    random16_set_seed(1337);
+    for (uint16_t i = 0; i < MAX_LEDS; i++) {
+        indices[i] = random8();
+        bright[i] = random8();
+    }
+    uint32_t start = micros();
+    expanded->update(palette);
+    const uint32_t expandMicros = micros() - start;
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        // Uniform brightness, then per-pixel brightness (bright == nullptr marks the first)
+        for (const uint8_t* brightness : {(const uint8_t*)nullptr, (const uint8_t*)bright}) {
+            uint32_t callMicros = 0, gatherMicros = 0, expandedMicros = 0;
+            uint32_t mismatches = 0;
+            for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+                const uint8_t offset = f * 5;
+                const uint8_t level = 96 + f;
+
+                start = micros();
+                for (uint16_t i = 0; i < count; i++) {
+                    reference[i] = ColorFromPalette(palette, indices[i] + offset, brightness ? brightness[i] : level, LINEARBLEND);
+                }
+                callMicros += micros() - start;
+
+                start = micros();
+                if (brightness) Render::gatherPalette(gathered, palette, indices, offset, brightness, count);
+                else Render::gatherPalette(gathered, palette, indices, offset, level, count);
+                gatherMicros += micros() - start;
+                for (uint16_t i = 0; i < count; i++) mismatches += gathered[i] != reference[i];
+
+                start = micros();
+                if (brightness) expanded->gather(gathered, indices, offset, brightness, count);
+                else expanded->gather(gathered, indices, offset, level, count);
+                expandedMicros += micros() - start;
+                for (uint16_t i = 0; i < count; i++) mismatches += gathered[i] != reference[i];
+                yield();
+            }
+
+            Serial.print(F("[BENCH] {\"suite\":\"gather\",\"leds\":")); Serial.print(count);
+            Serial.print(F(",\"bright\":\"")); Serial.print(brightness ? F("array") : F("uniform"));
+            Serial.print(F("\",\"us_call\":")); Serial.print(callMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_gather\":")); Serial.print(gatherMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_expanded\":")); Serial.print(expandedMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_expand_once\":")); Serial.print(expandMicros);
+            Serial.print(F(",\"speedup\":")); Serial.print(expandedMicros ? (float)callMicros / expandedMicros : 0.0f, 2);
+            Serial.print(F(",\"mismatches\":")); Serial.print(mismatches);
+            Serial.println(F("}"));
+        }
+    }
+
+    delete expanded;
+    delete[] reference;
+    delete[] gathered;
+    delete[] indices;
+    delete[] bright;
+}
+
+void runHsvKernels() {
+    enum Case : uint8_t { RAINBOW, HUE_FADE, HUE_ARRAY, CASE_COUNT };
+    static const char* const names[] = {"fill_rainbow", "fill_hue", "hue_array"};
+    CRGB* reference = new CRGB[MAX_LEDS];
+    CRGB* batched = new CRGB[MAX_LEDS];
+    uint8_t* hues = new uint8_t[MAX_LEDS];
+    uint8_t* vals = new uint8_t[MAX_LEDS];
+
+    random16_set_seed(1337);
+    for (uint16_t i = 0; i < MAX_LEDS; i++) {
+        hues[i] = random8();
+        vals[i] = random8();
+    }
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        for (uint8_t c = 0; c < CASE_COUNT; c++) {
+            uint32_t perPixelMicros = 0, batchedMicros = 0;
+            uint32_t mismatches = 0;
+            for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+                const uint8_t hue = f * 3;
+                const uint8_t val = 100 + f;
+
+                uint32_t start = micros();
+                switch (c) {
+                    case RAINBOW: fill_rainbow(reference, count, hue, 7); break;
+                    case HUE_FADE: for (uint16_t i = 0; i < count; i++) reference[i] = CHSV(hue + i * 5, 255, val); break;
+                    default: for (uint16_t i = 0; i < count; i++) reference[i] = CHSV(hues[i] + hue, 240, vals[i]); break;
+                }
+                perPixelMicros += micros() - start;
+
+                start = micros();
+                switch (c) {
+                    case RAINBOW: Render::fillRainbow(batched, count, hue, 7); break;
+                    case HUE_FADE: Render::fillHue(batched, count, hue, 5, 255, val); break;
+                    default: Render::hsvToRgb(batched, hues, hue, 240, vals, count); break;
+                }
+                batchedMicros += micros() - start;
+
+                for (uint16_t i = 0; i < count; i++) mismatches += batched[i] != reference[i];
+                yield();
+            }
+
+            Serial.print(F("[BENCH] {\"suite\":\"hsv\",\"kernel\":\"")); Serial.print(names[c]);
+            Serial.print(F("\",\"leds\":")); Serial.print(count);
+            Serial.print(F(",\"us_per_pixel\":")); Serial.print(perPixelMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_batched\":")); Serial.print(batchedMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_saved\":")); Serial.print(((int32_t)perPixelMicros - (int32_t)batchedMicros) / BENCH_FRAMES);
+            Serial.print(F(",\"mismatches\":")); Serial.print(mismatches);
+            Serial.println(F("}"));
+        }
+    }
+
+    delete[] reference;
+    delete[] batched;
+    delete[] hues;
+    delete[] vals;
+}
+
+void runParticles() {
+    static const uint16_t particleCounts[] = {50, 200, 500};
+    CRGB* buf = new CRGB[MAX_LEDS];
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        for (uint16_t particles : particleCounts) {
+            ParticlePool pool(particles);
+            pool.setBounds(0, count, ParticlePool::Edge::WRAP);
+            pool.setFadeOut(true);
+            random16_set_seed(1337);
+
+            uint32_t updateMicros = 0, renderMicros = 0;
+            const uint32_t heapBefore = ESP.getFreeHeap();
+            for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+                // Keep the pool full: respawn whatever expired last frame
+                while (pool.count() < particles) {
+                    pool.spawn(ParticlePool::pixels(random16(count)), ((int32_t)random16(4000) - 2000) << 8,
+                               CHSV(random8(), 255, 255), random16(200, 2000), random16(128, 768));
+                }
+                uint32_t start = micros();
+                pool.update(ANIMATION_UPDATE_INTERVAL);
+                updateMicros += micros() - start;
+
+                fill_solid(buf, count, CRGB::Black);
+                start = micros();
+                pool.render(buf, count);
+                renderMicros += micros() - start;
+                yield();
+            }
+            const int32_t heapDelta = (int32_t)heapBefore - (int32_t)ESP.getFreeHeap();
+
+            Serial.print(F("[BENCH] {\"suite\":\"particles\",\"leds\":")); Serial.print(count);
+            Serial.print(F(",\"particles\":")); Serial.print(particles);
+            Serial.print(F(",\"us_update\":")); Serial.print(updateMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_render\":")); Serial.print(renderMicros / BENCH_FRAMES);
+            Serial.print(F(",\"heap_delta\":")); Serial.print(heapDelta);
+            Serial.println(F("}"));
+        }
+    }
+
+    delete[] buf;
+}
+
+void runHeatField() {
+    static const uint8_t sourceCounts[] = {1, 2, 4};
+    const uint32_t frameBudget = 1000000UL / TARGET_FPS;
+    CRGB* buf = new CRGB[MAX_LEDS];
+    const CRGBPalette16 palette = HeatColors_p;
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        for (uint8_t sources : sourceCounts) {
+            // Sources split the strip into equal segments, alternating direction
+            HeatField field;
+            field.configure(count);
+            const uint16_t segment = count / sources;
+            for (uint8_t s = 0; s < sources; s++) {
+                const bool reverse = s & 1;
+                field.addSource(reverse ? (s + 1) * segment - 1 : s * segment, segment, reverse);
+            }
+            random16_set_seed(1337);
+
+            uint32_t stepMicros = 0, renderMicros = 0;
+            for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+                uint32_t start = micros();
+                field.update(ANIMATION_UPDATE_INTERVAL);
+                stepMicros += micros() - start;
+                start = micros();
+                field.render(buf, palette);
+                renderMicros += micros() - start;
+                yield();
+            }
+
+            const uint32_t perFrame = (stepMicros + renderMicros) / BENCH_FRAMES;
+            Serial.print(F("[BENCH] {\"suite\":\"fire\",\"leds\":")); Serial.print(count);
+            Serial.print(F(",\"sources\":")); Serial.print(sources);
+            Serial.print(F(",\"us_step\":")); Serial.print(stepMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_render\":")); Serial.print(renderMicros / BENCH_FRAMES);
+            Serial.print(F(",\"budget_pct\":")); Serial.print(100.0f * perFrame / frameBudget, 1);
+            Serial.println(F("}"));
+        }
+    }
+
+    delete[] buf;
+}
+
+void runWaves() {
+    enum Case : uint8_t { TWO_SIN, THREE_SIN, PLASMA, CASE_COUNT };
+    static const char* const names[] = {"two_sin", "three_sin", "plasma"};
+    CRGB* reference = new CRGB[MAX_LEDS];
+    CRGB* banked = new CRGB[MAX_LEDS];
+    uint8_t* refIndex = new uint8_t[MAX_LEDS];
+    uint8_t* index = new uint8_t[MAX_LEDS];
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        for (uint8_t c = 0; c < CASE_COUNT; c++) {
+            // Same setups as the Two Sin, Three Sin and Plasma Effect animations
+            WaveBank waves;
+            switch (c) {
+                case TWO_SIN:
+                    waves.add(WaveBank::Shape::CUBIC, 32, 1, 0, 96);
+                    waves.add(WaveBank::Shape::CUBIC, 32, 1, 128, 96);
+                    break;
+                case THREE_SIN:
+                    waves.add(WaveBank::Shape::SINE, 5, 2, 0, 80);
+                    waves.add(WaveBank::Shape::SINE, 8, 1, 0, 80);
+                    waves.add(WaveBank::Shape::SINE, 7, -3, 0, 80);
+                    break;
+                default:
+                    waves.add(WaveBank::Shape::SINE, 10, 2);
+                    waves.add(WaveBank::Shape::SINE, 10, -2, 64);
+                    break;
+            }
+
+            uint32_t perPixelMicros = 0, bankedMicros = 0;
+            uint32_t mismatches = 0;
+            for (uint8_t f = 1; f <= BENCH_FRAMES; f++) {
+                const uint8_t phase = f;
+
+                uint32_t start = micros();
+                switch (c) {
+                    case TWO_SIN:
+                        for (uint16_t k = 0; k < count; k++) {
+                            reference[k] = CHSV(1, 255, qsuba(cubicwave8(k * 32 + phase), 96));
+                            reference[k] += CHSV(129, 255, qsuba(cubicwave8(k * 32 + 128 + phase), 96));
+                        }
+                        break;
+                    case THREE_SIN:
+                        for (uint16_t k = 0; k < count; k++) {
+                            reference[k].r = qsub8(sin8(5 * k + 2 * phase), 80);
+                            reference[k].g = qsub8(sin8(8 * k + phase), 80);
+                            reference[k].b = qsub8(sin8(7 * k - 3 * phase), 80);
+                        }
+                        break;
+                    default:
+                        for (uint16_t k = 0; k < count; k++) {
+                            refIndex[k] = sin8(k * 10 + 2 * phase) + cos8(k * 10 - 2 * phase);
+                        }
+                        break;
+                }
+                perPixelMicros += micros() - start;
+
+                start = micros();
+                waves.advance(NOMINAL_FRAME_MS);
+                switch (c) {
+                    case TWO_SIN:
+                        waves.render(0, index, count);
+                        Render::shadeHue(banked, 1, 255, index, count);
+                        waves.render(1, index, count);
+                        Render::shadeHue(banked, 129, 255, index, count, true);
+                        break;
+                    case THREE_SIN:
+                        for (uint8_t ch = 0; ch < 3; ch++) waves.render(ch, &banked[0].raw[ch], count, sizeof(CRGB));
+                        break;
+                    default:
+                        waves.render(0, index, count);
+                        waves.render(1, index, count, 1, true);
+                        break;
+                }
+                bankedMicros += micros() - start;
+
+                if (c == PLASMA) {
+                    for (uint16_t k = 0; k < count; k++) mismatches += index[k] != refIndex[k];
+                } else {
+                    for (uint16_t k = 0; k < count; k++) mismatches += banked[k] != reference[k];
+                }
+                yield();
+            }
+
+            Serial.print(F("[BENCH] {\"suite\":\"waves\",\"kernel\":\"")); Serial.print(names[c]);
+            Serial.print(F("\",\"leds\":")); Serial.print(count);
+            Serial.print(F(",\"us_per_pixel\":")); Serial.print(perPixelMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_banked\":")); Serial.print(bankedMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_saved\":")); Serial.print(((int32_t)perPixelMicros - (int32_t)bankedMicros) / BENCH_FRAMES);
+            Serial.print(F(",\"mismatches\":")); Serial.print(mismatches);
+            Serial.println(F("}"));
+        }
+    }
+
+    delete[] reference;
+    delete[] banked;
+    delete[] refIndex;
+    delete[] index;
+}
+
+void runComets() {
+    static const uint8_t cometCounts[] = {1, 8};
+    CRGB* faded = new CRGB[MAX_LEDS];
+    CRGB* trails = new CRGB[MAX_LEDS];
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        for (uint8_t comets : cometCounts) {
+            // Juggle-style dots sweeping at different rates
+            CometTrails engine;
+            engine.configure(count, 20);
+            TempoClock tempo;
+            uint32_t fadeMicros = 0, engineMicros = 0, dirtyPixels = 0;
+            fill_solid(faded, count, CRGB::Black);
+
+            for (uint8_t f = 0; f < BENCH_FRAMES; f++) {
+                const FrameContext frame = benchFrame(f, tempo);
+
+                uint32_t start = micros();
+                fadeToBlackBy(faded, count, 20);
+                for (uint8_t i = 0; i < comets; i++) {
+                    faded[frame.beatsin16(i + 7, 0, count - 1)] |= CHSV(i * 32, 200, 255);
+                }
+                fadeMicros += micros() - start;
+
+                start = micros();
+                engine.advance(frame.deltaMs);
+                for (uint8_t i = 0; i < comets; i++) {
+                    engine.moveTo(i, CometTrails::sweep(frame.beatsin16(i + 7), count), CHSV(i * 32, 200, 255));
+                }
+                engine.render(trails);
+                engineMicros += micros() - start;
+                dirtyPixels += engine.dirtyPixels();
+                yield();
+            }
+
+            Serial.print(F("[BENCH] {\"suite\":\"comets\",\"leds\":")); Serial.print(count);
+            Serial.print(F(",\"comets\":")); Serial.print(comets);
+            Serial.print(F(",\"us_full_fade\":")); Serial.print(fadeMicros / BENCH_FRAMES);
+            Serial.print(F(",\"us_trails\":")); Serial.print(engineMicros / BENCH_FRAMES);
+            Serial.print(F(",\"dirty_pixels\":")); Serial.print(dirtyPixels / BENCH_FRAMES);
+            Serial.println(F("}"));
+        }
+    }
+
+    delete[] faded;
+    delete[] trails;
+}
+
+void runSparkles() {
+    // Twinkle Stars settings: one new pixel per frame, fading by 10/256
+    const uint16_t frames = 200; // Long enough for the lit count to level off
+    CRGB* faded = new CRGB[MAX_LEDS];
+    CRGB* sparse = new CRGB[MAX_LEDS];
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        SparkleField field;
+        field.configure(count, 10);
+        fill_solid(faded, count, CRGB::Black);
+        uint32_t fadeMicros = 0, sparseMicros = 0, changed = 0;
+
+        for (uint16_t f = 0; f < frames; f++) {
+            random16_set_seed(f);
+            uint32_t start = micros();
+            fadeToBlackBy(faded, count, 10);
+            faded[random16(count)] += CHSV(random8(64, 192), 200, 255);
+            fadeMicros += micros() - start;
+
+            random16_set_seed(f);
+            start = micros();
+            field.update(NOMINAL_FRAME_MS);
+            field.light(random16(count), CHSV(random8(64, 192), 200, 255));
+            field.render(sparse);
+            sparseMicros += micros() - start;
+
+            const uint16_t* list;
+            uint16_t n;
+            if (field.changed(list, n)) changed += n;
+            if ((f & 31) == 0) yield();
+        }
+
+        Serial.print(F("[BENCH] {\"suite\":\"sparkle\",\"leds\":")); Serial.print(count);
+        Serial.print(F(",\"us_full_fade\":")); Serial.print(fadeMicros / frames);
+        Serial.print(F(",\"us_sparse\":")); Serial.print(sparseMicros / frames);
+        Serial.print(F(",\"lit\":")); Serial.print(field.litCount());
+        Serial.print(F(",\"changed_per_frame\":")); Serial.print(changed / frames);
+        Serial.println(F("}"));
+    }
+
+    delete[] faded;
+    delete[] sparse;
+}
+
+void runAutomata() {
+    const uint16_t generations = 200;
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        random16_set_seed(1337);
+        ElementaryAutomaton elementary;
+        elementary.configure(count);
+        elementary.setRule(110);
+        elementary.seedRandom();
+        uint32_t start = micros();
+        for (uint16_t g = 0; g < generations; g++) elementary.step();
+        const uint32_t elementaryMicros = micros() - start;
+        yield();
+
+        CyclicAutomaton cyclic;
+        cyclic.configure(count, 4);
+        cyclic.seedRandom();
+        start = micros();
+        for (uint16_t g = 0; g < generations; g++) cyclic.step();
+        const uint32_t cyclicMicros = micros() - start;
+        yield();
+
+        Serial.print(F("[BENCH] {\"suite\":\"automata\",\"leds\":")); Serial.print(count);
+        Serial.print(F(",\"ns_per_generation_rule110\":")); Serial.print(elementaryMicros * 1000UL / generations);
+        Serial.print(F(",\"ns_per_generation_cyclic16\":")); Serial.print(cyclicMicros * 1000UL / generations);
+        Serial.println(F("}"));
+    }
+
+    // Rules 30, 90 and 110 and every cyclic state count
+    for (uint16_t count : AUTOMATA_CHECKED_COUNTS) {
+        uint32_t mismatches = 0;
+        for (uint8_t rule : {30, 90, 110}) mismatches += checkElementary(count, rule);
+        for (uint8_t bits = 1; bits <= CyclicAutomaton::MAX_PLANES; bits++) mismatches += checkCyclic(count, bits);
+        yield();
+        Serial.print(F("[BENCH] {\"suite\":\"automata_check\",\"leds\":")); Serial.print(count);
+        Serial.print(F(",\"mismatches\":")); Serial.print(mismatches);
+        Serial.println(F("}"));
+    }
+}
+
+void runPrimitives() {
+    CRGB* a = new CRGB[MAX_LEDS];
+    CRGB* b = new CRGB[MAX_LEDS];
+    CRGB* out = new CRGB[MAX_LEDS];
+    uint8_t* indices = new uint8_t[MAX_LEDS];
+    uint16_t* values = new uint16_t[MAX_LEDS];
+    const CRGBPalette16 palette16 = PartyColors_p;
+    const CRGBPalette256 palette256 = palette16;
+
+    random16_set_seed(1337);
+    for (uint16_t i = 0; i < MAX_LEDS; i++) {
+        indices[i] = random8();
+        a[i] = CHSV(random8(), 255, 255);
+        b[i] = CHSV(random8(), 200, random8());
+    }
+
+    for (uint16_t count : BENCH_LED_COUNTS) {
+        timePrimitive("inoise8", "", count, [&](uint8_t f) {
+            for (uint16_t i = 0; i < count; i++) indices[i] = inoise8(i * 30 + f * 3, f * 5);
+            benchSink = indices[count / 2];
+        });
+
+        // Same indices for every variant, so only the lookup differs
+        static const char* const blendNames[] = {"noblend", "linear"};
+        static const TBlendType blendTypes[] = {NOBLEND, LINEARBLEND};
+        for (uint8_t t = 0; t < 2; t++) {
+            char variant[16];
+            snprintf(variant, sizeof(variant), "p16_%s", blendNames[t]);
+            timePrimitive("ColorFromPalette", variant, count, [&](uint8_t f) {
+                for (uint16_t i = 0; i < count; i++) out[i] = ColorFromPalette(palette16, indices[i] + f, 200, blendTypes[t]);
+                benchSink = out[count / 2].r;
+            });
+            snprintf(variant, sizeof(variant), "p256_%s", blendNames[t]);
+            timePrimitive("ColorFromPalette", variant, count, [&](uint8_t f) {
+                for (uint16_t i = 0; i < count; i++) out[i] = ColorFromPalette(palette256, indices[i] + f, 200, blendTypes[t]);
+                benchSink = out[count / 2].r;
+            });
+        }
+
+        timePrimitive("fadeToBlackBy", "", count, [&](uint8_t) {
+            memcpy(out, a, sizeof(CRGB) * count); // Never fades to all black
+            fadeToBlackBy(out, count, 20);
+            benchSink = out[count / 2].r;
+        });
+        timePrimitive("blur1d", "", count, [&](uint8_t) {
+            memcpy(out, a, sizeof(CRGB) * count);
+            blur1d(out, count, 64);
+            benchSink = out[count / 2].r;
+        });
+        timePrimitive("blend", "", count, [&](uint8_t f) {
+            for (uint16_t i = 0; i < count; i++) out[i] = blend(a[i], b[i], f * 5);
+            benchSink = out[count / 2].r;
+        });
+        timePrimitive("fill_rainbow", "", count, [&](uint8_t f) {
+            fill_rainbow(out, count, f, 7);
+            benchSink = out[count / 2].r;
+        });
+        timePrimitive("CHSV", "rainbow", count, [&](uint8_t f) {
+            for (uint16_t i = 0; i < count; i++) out[i] = CHSV(indices[i] + f, 240, 200);
+            benchSink = out[count / 2].r;
+        });
+
+        // FastLED's version reads millis() on every call; FrameContext's
+        // reads the frame's timestamp
+        timePrimitive("beatsin88", "fastled", count, [&](uint8_t) {
+            for (uint16_t i = 0; i < count; i++) values[i] = beatsin88((60 << 8) + i, 0, 65535);
+            benchSink = values[count / 2];
+        });
+        FrameContext frame;
+        frame.nowMs = millis();
+        timePrimitive("beatsin88", "frame", count, [&](uint8_t) {
+            for (uint16_t i = 0; i < count; i++) values[i] = frame.beatsin88((60 << 8) + i, 0, 65535);
+            benchSink = values[count / 2];
+        });
+    }
+
+    // Palette-sized, so the strip length doesn't apply
+    timePrimitive("nblendPaletteTowardPalette", "", 16, [&](uint8_t f) {
+        CRGBPalette16 current = RainbowColors_p;
+        CRGBPalette16 target = palette16;
+        nblendPaletteTowardPalette(current, target, 48);
+        benchSink = current[f & 15].r;
+    });
+
+    delete[] a;
+    delete[] b;
+    delete[] out;
+    delete[] indices;
+    delete[] values;
+}
+
+} // namespace Benchmarks
@@ -0,0 +1,55 @@
+/**
+ * Render Benchmarks
+ * Boot-time performance measurements streamed over Serial as JSON lines.
+ * Enable with ENABLE_BENCHMARKS in Config.h.
+ */
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#include <Arduino.h>
+
+namespace Benchmarks {
+    // Runs every suite below; needs the animation registry to be populated
+    void runAll();
+
+    // Full vs sub-resolution rendering for animations that opted in
+    void runSubResolution();
+
+    // FixedMath helpers vs the libm calls they replace: time and max error
+    void runFixedMath();
+
+    // NoiseField vs per-pixel inoise8 over a drifting span: time and error
+    void runNoiseField();
+
+    // PaletteService blend cost per frame and the RAM saved by shared/flash palettes
+    void runPalettes();
+
+    // Batched palette gathers vs per-pixel ColorFromPalette: time and mismatches
+    void runPaletteGather();
+
+    // HSV span kernels vs per-pixel CHSV conversion: time and mismatches
+    void runHsvKernels();
+
+    // ParticlePool update and render cost by particle count, plus heap churn
+    void runParticles();
+
+    // HeatField step and render cost against the frame budget
+    void runHeatField();
+
+    // WaveBank phase accumulators vs per-pixel sin8/cubicwave8 terms
+    void runWaves();
+
+    // CometTrails dirty-span redraw vs full-strip fadeToBlackBy trails
+    void runComets();
+
+    // SparkleField lit-pixel updates vs full-strip fadeToBlackBy twinkles
+    void runSparkles();
+
+    // Bit-packed automaton cost per generation
+    void runAutomata();
+
+    // The FastLED primitives behind most frame time, median ns per call
+    void runPrimitives();
+}
+
+#endif // BENCHMARKS_H
@@ -0,0 +1,149 @@
+/**
+ * Frame Export Implementation
+ *
+ * The run mirrors GoldenFrames: the animation is created with createSeeded()
+ * into its own buffer and driven with a FrameContext built from a virtual
+ * clock, so the same command always streams the same bytes. Fast-forward
+ * frames are rendered but not sent; only their count and step size decide
+ * where the exported clip starts. A warp is at most MAX_WARP_STEPS frames;
+ * longer ones get a larger step, reported back as step_ms.
+ */
+#include "FrameExport.h"
+#include <FastLED.h>
+#include "../animations/AnimationBase.h"
+#include "../animations/AnimationManager.h"
+#include "../config/Config.h"
+
+namespace {
+
+const uint16_t MAX_FPS = 240;
+const uint32_t MAX_WARP_STEPS = 100000; // Longer warps take coarser steps
+const char FRAME_MAGIC[2] = {'F', 'X'};
+
+void writeU32(uint32_t value) {
+    uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+    Serial.write(bytes, sizeof(bytes));
+}
+
+void printError(const char* message) {
+    Serial.print(F("[EXPORT] {\"error\":\"")); Serial.print(message); Serial.println(F("\"}"));
+}
+
+const AnimationInfo* findAnimation(const char* name) {
+    for (const AnimationInfo& info : globalAnimationRegistry) {
+        if (strcmp(info.name, name) == 0) return &info;
+    }
+    return nullptr;
+}
+
+void list() {
+    for (uint16_t i = 0; i < globalAnimationRegistry.size(); i++) {
+        Serial.print(F("[EXPORT] {\"index\":")); Serial.print(i);
+        Serial.print(F(",\"name\":\"")); Serial.print(globalAnimationRegistry[i].name);
+        Serial.println(F("\"}"));
+    }
+    Serial.println(F("[EXPORT] {\"done\":true}"));
+}
+
+void exportFrames(AnimationManager& manager, const char* args) {
+    unsigned int leds, fps, seed, frames;
+    unsigned long startMs, stepMs;
+    int nameAt = 0;
+    if (sscanf(args, "%u %u %u %lu %lu %u %n", &leds, &fps, &seed, &startMs, &stepMs, &frames, &nameAt) < 6 || !nameAt) {
+        printError("usage: export <leds> <fps> <seed> <start_ms> <step_ms> <frames> <name>");
+        return;
+    }
+    const AnimationInfo* info = findAnimation(args + nameAt);
+    if (!info) {
+        printError("unknown animation");
+        return;
+    }
+    if (leds < 1 || leds > MAX_LEDS || fps < 1 || fps > MAX_FPS || frames < 1) {
+        printError("leds, fps or frames out of range");
+        return;
+    }
+
+    // Release the live animation so its palette fades don't share the blend
+    // budget; restoring it afterwards must not rewrite the saved pattern
+    manager.setPersistence(false);
+    manager.releaseAnimation();
+    CRGB* buf = new CRGB[leds];
+    fill_solid(buf, leds, CRGB::Black);
+    Animation* anim = createSeeded(*info, buf, leds, seed);
+    if (!anim) {
+        delete[] buf;
+        printError("create failed");
+        manager.setCurrentPattern(manager.getCurrentPatternIndex());
+        manager.setPersistence(true);
+        return;
+    }
+    anim->setBrightness(DEFAULT_BRIGHTNESS);
+
+    const uint32_t periodMs = 1000 / fps;
+    if (stepMs == 0) stepMs = periodMs;
+    if (startMs / stepMs > MAX_WARP_STEPS) stepMs = (startMs + MAX_WARP_STEPS - 1) / MAX_WARP_STEPS;
+    TempoClock tempo;
+    FrameContext frame;
+    auto step = [&](uint32_t deltaMs) {
+        frame.nowMs += deltaMs;
+        frame.deltaMs = deltaMs;
+        frame.frameCount++;
+        tempo.advance(frame);
+        PaletteService::tick(deltaMs);
+        anim->renderFrame(frame);
+    };
+
+    // Fast-forward to the start; the last partial step lands on it exactly
+    const unsigned long warpStart = millis();
+    frame.frameCount = (uint32_t)-1;
+    for (uint32_t elapsed = 0; elapsed < startMs; ) {
+        const uint32_t deltaMs = min((uint32_t)stepMs, (uint32_t)(startMs - elapsed));
+        step(deltaMs);
+        elapsed += deltaMs;
+        if ((frame.frameCount & 0xFF) == 0) yield();
+    }
+
+    Serial.print(F("[EXPORT] {\"anim\":\"")); Serial.print(info->name);
+    Serial.print(F("\",\"leds\":")); Serial.print(leds);
+    Serial.print(F(",\"fps\":")); Serial.print(fps);
+    Serial.print(F(",\"seed\":")); Serial.print(seed);
+    Serial.print(F(",\"start_ms\":")); Serial.print(startMs);
+    Serial.print(F(",\"step_ms\":")); Serial.print(stepMs);
+    Serial.print(F(",\"frames\":")); Serial.print(frames);
+    Serial.print(F(",\"warp_ms\":")); Serial.print(millis() - warpStart);
+    Serial.println(F("}"));
+
+    for (uint32_t f = 0; f < frames; f++) {
+        step(f == 0 && startMs == 0 ? 0 : periodMs);
+        Serial.write((const uint8_t*)FRAME_MAGIC, sizeof(FRAME_MAGIC));
+        writeU32(f);
+        writeU32(frame.nowMs);
+        Serial.write(reinterpret_cast<const uint8_t*>(buf), leds * sizeof(CRGB));
+        yield();
+    }
+    Serial.flush();
+    Serial.println();
+    Serial.println(F("[EXPORT] {\"done\":true}"));
+
+    delete anim;
+    delete[] buf;
+    manager.setCurrentPattern(manager.getCurrentPatternIndex());
+    manager.setPersistence(true);
+}
+
+} // namespace
+
+namespace FrameExport {
+
+bool handle(AnimationManager& manager, const char* line) {
+    if (strcmp(line, "list") == 0) {
+        list();
+    } else if (strncmp(line, "export ", 7) == 0) {
+        exportFrames(manager, line + 7);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace FrameExport
@@ -0,0 +1,37 @@
+/**
+ * Frame Export
+ * Renders any registered animation off the strip, at a chosen LED count,
+ * frame rate and seed on a virtual clock, and streams the frames over
+ * Serial. A start offset fast-forwards the animation first, so hours of
+ * palette changes can be reached without waiting for them. Drive it with
+ * tools/export_frames.py, which writes PPM strips, an ANSI preview or a
+ * raw frame stream. On a board, enable with ENABLE_FRAME_EXPORT in
+ * Config.h; the native build (host/HostMain.cpp) runs the same commands
+ * from its arguments without one.
+ *
+ * Commands, one per line (see SerialCommands.h):
+ *   list
+ *   export <leds> <fps> <seed> <start_ms> <step_ms> <frames> <name>
+ * step_ms is the virtual time per fast-forward frame; 0 uses the frame
+ * period, which matches a real run exactly. Warps longer than
+ * MAX_WARP_STEPS frames use a larger step. It is not clamped to
+ * MAX_FRAME_DELTA_MS the way AnimationManager clamps live frames, so larger
+ * steps hand update() deltas it never sees on a running strip.
+ *
+ * Output: a "[EXPORT] " JSON header line, then per frame the bytes "FX",
+ * the frame index and nowMs (uint32, little-endian) and leds * 3 bytes of
+ * RGB, then a closing "[EXPORT] " JSON line.
+ */
+#ifndef FRAME_EXPORT_H
+#define FRAME_EXPORT_H
+
+#include <Arduino.h>
+
+class AnimationManager;
+
+namespace FrameExport {
+    // Runs "list" or "export ..."; returns false for any other command
+    bool handle(AnimationManager& manager, const char* line);
+}
+
+#endif // FRAME_EXPORT_H
@@ -0,0 +1,152 @@
+/**
+ * Golden Frames Implementation
+ *
+ * Status per animation and strip length:
+ *   ok       hash matches the table
+ *   changed  hash differs from the table
+ *   new      no table entry yet
+ *   overrun  a pixel at or past numLeds was written (hash still printed)
+ */
+#include "GoldenFrames.h"
+#include <FastLED.h>
+#include "../animations/AnimationBase.h"
+#include "../animations/AnimationManager.h"
+#include "../config/Config.h"
+
+namespace {
+
+const uint16_t GOLDEN_LED_COUNTS[] = {1, 7, 300, 1000};
+const uint8_t GOLDEN_FRAMES = 40;
+const uint8_t GOLDEN_TRIGGER_FRAME = GOLDEN_FRAMES / 2; // One user hit mid-run
+const uint16_t GOLDEN_SEED = 0x5EED;
+const uint16_t GUARD_PIXELS = 16; // Canary pixels past MAX_LEDS
+const CRGB CANARY(0xA5, 0x5A, 0xC3);
+
+const uint32_t FNV_OFFSET = 2166136261UL;
+const uint32_t FNV_PRIME = 16777619UL;
+
+uint32_t hashPixels(uint32_t hash, const CRGB* pixels, uint16_t count) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(pixels);
+    for (uint32_t i = 0; i < (uint32_t)count * sizeof(CRGB); i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// First pixel from `from` on that lost its canary, or -1
+int32_t findOverrun(const CRGB* buf, uint16_t from, uint16_t to) {
+    for (uint16_t i = from; i < to; i++) {
+        if (buf[i] != CANARY) return i;
+    }
+    return -1;
+}
+
+const GoldenFrames::Entry* findApproved(const char* name, uint16_t leds) {
+    for (const GoldenFrames::Entry* e = GoldenFrames::TABLE; e->anim; e++) {
+        if (e->leds == leds && strcmp(e->anim, name) == 0) return e;
+    }
+    return nullptr;
+}
+
+void printHash(uint32_t hash) {
+    char text[11];
+    snprintf(text, sizeof(text), "0x%08lx", (unsigned long)hash);
+    Serial.print(text);
+}
+
+} // namespace
+
+namespace GoldenFrames {
+
+uint16_t runAll(AnimationManager& manager) {
+    Serial.println(F("=== Golden frames start ==="));
+    manager.releaseAnimation();
+
+    const uint16_t bufferSize = MAX_LEDS + GUARD_PIXELS;
+    CRGB* buf = new CRGB[bufferSize];
+    uint16_t checked = 0, changed = 0, fresh = 0, overruns = 0;
+
+    for (const AnimationInfo& info : globalAnimationRegistry) {
+        for (uint16_t count : GOLDEN_LED_COUNTS) {
+            fill_solid(buf, bufferSize, CANARY);
+            fill_solid(buf, count, CRGB::Black);
+            Animation* anim = createSeeded(info, buf, count, GOLDEN_SEED);
+            if (!anim) continue;
+            anim->setBrightness(DEFAULT_BRIGHTNESS);
+
+            // Virtual clock: a steady nominal frame period from time zero
+            TempoClock tempo;
+            FrameContext frame;
+            uint32_t hash = FNV_OFFSET;
+            int32_t overrunAt = -1;
+            uint8_t overrunFrame = 0;
+            for (uint8_t f = 0; f < GOLDEN_FRAMES; f++) {
+                frame.nowMs = f * NOMINAL_FRAME_MS;
+                frame.deltaMs = NOMINAL_FRAME_MS;
+                frame.frameCount = f;
+                frame.onTrigger = f == GOLDEN_TRIGGER_FRAME;
+                tempo.advance(frame);
+                PaletteService::tick(frame.deltaMs);
+
+                anim->renderFrame(frame);
+                hash = hashPixels(hash, buf, count);
+                if (overrunAt < 0) {
+                    overrunAt = findOverrun(buf, count, bufferSize);
+                    overrunFrame = f;
+                }
+                yield();
+            }
+            delete anim;
+
+            const Entry* approved = findApproved(info.name, count);
+            const char* status = "ok";
+            if (overrunAt >= 0) {
+                status = "overrun";
+                overruns++;
+            } else if (!approved) {
+                status = "new";
+                fresh++;
+            } else if (approved->hash != hash) {
+                status = "changed";
+                changed++;
+            }
+            checked++;
+
+            Serial.print(F("[GOLDEN] {\"anim\":\"")); Serial.print(info.name);
+            Serial.print(F("\",\"leds\":")); Serial.print(count);
+            Serial.print(F(",\"hash\":\"")); printHash(hash);
+            if (approved) {
+                Serial.print(F("\",\"approved\":\"")); printHash(approved->hash);
+            }
+            Serial.print(F("\",\"status\":\"")); Serial.print(status);
+            if (overrunAt >= 0) {
+                Serial.print(F("\",\"overrun_pixel\":")); Serial.print(overrunAt);
+                Serial.print(F(",\"overrun_frame\":")); Serial.print(overrunFrame);
+                Serial.println(F("}"));
+            } else {
+                Serial.println(F("\"}"));
+            }
+        }
+    }
+    delete[] buf;
+
+    Serial.print(F("[GOLDEN] {\"summary\":true,\"checked\":")); Serial.print(checked);
+    Serial.print(F(",\"changed\":")); Serial.print(changed);
+    Serial.print(F(",\"new\":")); Serial.print(fresh);
+    Serial.print(F(",\"overruns\":")); Serial.print(overruns);
+    Serial.print(F(",\"baseline\":")); Serial.print(TABLE[0].anim ? F("true") : F("false"));
+    Serial.print(F(",\"fastled\":")); Serial.print((uint32_t)FASTLED_VERSION);
+    Serial.print(F(",\"approved_fastled\":")); Serial.print(TABLE_FASTLED_VERSION);
+    Serial.println(F("}"));
+    if (!TABLE[0].anim) {
+        Serial.println(F("[WARNING] GoldenTable.cpp is empty; approve this run with tools/approve_golden.py"));
+    } else if (TABLE_FASTLED_VERSION != FASTLED_VERSION) {
+        Serial.println(F("[WARNING] GoldenTable.cpp was approved with another FastLED; changed hashes are expected"));
+    }
+    Serial.println(F("=== Golden frames done ==="));
+
+    manager.setCurrentPattern(manager.getCurrentPatternIndex());
+    return changed + overruns + fresh;
+}
+
+} // namespace GoldenFrames
@@ -0,0 +1,40 @@
+/**
+ * Golden Frames
+ * Boot-time output regression check. Every registered animation renders a
+ * fixed run of frames at several strip lengths, from a fixed random seed on
+ * a virtual clock, and the hash of those frames is compared with the
+ * approved value in GoldenTable.cpp. Pixels past numLeds are filled with a
+ * canary colour, and any frame that overwrites one is reported as an
+ * overrun. Enable with ENABLE_GOLDEN_FRAMES in Config.h.
+ *
+ * Results are printed as JSON lines prefixed "[GOLDEN] ". When a change in
+ * the output is intended, save the serial log and run
+ * tools/approve_golden.py on it to rewrite the table.
+ */
+#ifndef GOLDEN_FRAMES_H
+#define GOLDEN_FRAMES_H
+
+#include <Arduino.h>
+
+class AnimationManager;
+
+namespace GoldenFrames {
+    struct Entry {
+        const char* anim;  // Registry name
+        uint16_t leds;
+        uint32_t hash;     // FNV-1a over every frame of the run
+    };
+
+    // Approved hashes, ended by an entry with a null name (GoldenTable.cpp)
+    extern const Entry TABLE[];
+    // FASTLED_VERSION of the build the table was approved from (0 = none)
+    extern const uint32_t TABLE_FASTLED_VERSION;
+
+    // Checks every registry entry; returns the number of changed hashes,
+    // unapproved entries and overruns, so an empty table never passes.
+    // The manager's own animation is released for the run, so its palette
+    // fades don't share the blend budget, and recreated afterwards.
+    uint16_t runAll(AnimationManager& manager);
+}
+
+#endif // GOLDEN_FRAMES_H
@@ -0,0 +1,15 @@
+/**
+ * Golden Frames: approved hashes
+ * Generated by tools/approve_golden.py from a board or host (env:native)
+ * log; edit through the tool rather than by hand. Entries missing here
+ * report as "new" and count as failures. The hashes depend on FastLED's
+ * colour maths, which is why platformio.ini pins its version; re-approve
+ * after changing the pin.
+ */
+#include "GoldenFrames.h"
+
+const uint32_t GoldenFrames::TABLE_FASTLED_VERSION = 0;
+
+const GoldenFrames::Entry GoldenFrames::TABLE[] = {
+    {nullptr, 0, 0}
+};
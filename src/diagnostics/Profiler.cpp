@@ -0,0 +1,78 @@
+/**
+ * Profiler Implementation
+ *
+ * Events are written when a zone closes, so a parent lands in the ring after
+ * its children; the trace tool sorts by start. Everything runs on the loop
+ * task, so the ring has no locking.
+ */
+#include "Profiler.h"
+
+#if ENABLE_PROFILER
+
+namespace {
+
+Profiler::Event ring[PROFILER_RING_SIZE];
+uint16_t head = 0;       // Next slot to write
+uint16_t stored = 0;
+uint32_t dropped = 0;    // Overwritten since the last dump
+bool dumping = false;
+
+uint32_t ticksPerUs() {
+#ifdef ARDUINO
+    return getCpuFrequencyMhz();
+#else
+    return 1000;
+#endif
+}
+
+} // namespace
+
+namespace Profiler {
+
+uint8_t depth = 0;
+
+void record(const char* name, uint32_t start, uint32_t ticks, uint8_t zoneDepth) {
+    if (dumping) return;
+    Event& e = ring[head];
+    e.name = name;
+    e.start = start;
+    e.ticks = ticks;
+    e.depth = zoneDepth;
+    head = (head + 1) % PROFILER_RING_SIZE;
+    if (stored < PROFILER_RING_SIZE) stored++;
+    else dropped++;
+}
+
+void dump() {
+    dumping = true; // Serial output below must not land in the ring
+    Serial.print(F("[PROFILE] {\"ticks_per_us\":")); Serial.print(ticksPerUs());
+    Serial.print(F(",\"events\":")); Serial.print(stored);
+    Serial.print(F(",\"dropped\":")); Serial.print(dropped);
+    Serial.println(F("}"));
+
+    const uint16_t first = (head + PROFILER_RING_SIZE - stored) % PROFILER_RING_SIZE;
+    for (uint16_t i = 0; i < stored; i++) {
+        const Event& e = ring[(first + i) % PROFILER_RING_SIZE];
+        Serial.print(F("[PROFILE] {\"zone\":\"")); Serial.print(e.name);
+        Serial.print(F("\",\"start\":")); Serial.print(e.start);
+        Serial.print(F(",\"ticks\":")); Serial.print(e.ticks);
+        Serial.print(F(",\"depth\":")); Serial.print(e.depth);
+        Serial.println(F("}"));
+        if ((i & 0x3F) == 0) yield();
+    }
+    Serial.println(F("[PROFILE] {\"done\":true}"));
+
+    stored = 0;
+    dropped = 0;
+    dumping = false;
+}
+
+bool handle(const char* line) {
+    if (strcmp(line, "profile") != 0) return false;
+    dump();
+    return true;
+}
+
+} // namespace Profiler
+
+#endif // ENABLE_PROFILER
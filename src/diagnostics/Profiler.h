@@ -0,0 +1,83 @@
+/**
+ * Profiler
+ * Named timing zones for finding where a frame's time goes:
+ *
+ *   void update(const FrameContext& frame) override {
+ *       PROFILE_ZONE("liquid.waves");
+ *       ...
+ *   }
+ *
+ * A zone records its start and length when it goes out of scope, into a
+ * fixed RAM ring of PROFILER_RING_SIZE events; the oldest are overwritten.
+ * Timestamps are CPU cycles on the board and nanoseconds from a monotonic
+ * clock elsewhere. Names must outlive the dump (string literals or registry
+ * names). The "profile" Serial command streams the ring as "[PROFILE] "
+ * JSON lines and clears it; tools/profile_trace.py turns that into Chrome
+ * trace JSON (chrome://tracing or ui.perfetto.dev).
+ * Enable with ENABLE_PROFILER in Config.h; otherwise zones compile away.
+ */
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "../config/Config.h"
+
+#if ENABLE_PROFILER
+
+#ifndef ARDUINO
+#include <chrono>
+#endif
+
+namespace Profiler {
+    struct Event {
+        const char* name;
+        uint32_t start;  // Ticks
+        uint32_t ticks;  // Length
+        uint8_t depth;   // Zones open around this one
+    };
+
+    inline uint32_t now() {
+    #ifdef ARDUINO
+        return ESP.getCycleCount();
+    #else
+        return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    #endif
+    }
+
+    void record(const char* name, uint32_t start, uint32_t ticks, uint8_t depth);
+    extern uint8_t depth;
+
+    class Zone {
+    public:
+        explicit Zone(const char* zoneName) : name(zoneName), start(now()) { depth++; }
+        ~Zone() {
+            const uint32_t end = now();
+            depth--;
+            record(name, start, end - start, depth);
+        }
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+    private:
+        const char* name;
+        uint32_t start;
+    };
+
+    // Streams the ring oldest first and clears it
+    void dump();
+
+    // Runs "profile"; returns false for any other command
+    bool handle(const char* line);
+}
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_ZONE(name) Profiler::Zone PROFILE_CONCAT(profileZone, __LINE__)(name)
+
+#else
+
+#define PROFILE_ZONE(name) ((void)0)
+
+#endif // ENABLE_PROFILER
+
+#endif // PROFILER_H
@@ -0,0 +1,50 @@
+/**
+ * Serial Commands Implementation
+ */
+#include "SerialCommands.h"
+#include "../config/Config.h"
+#if ENABLE_FRAME_EXPORT
+#include "FrameExport.h"
+#endif
+#if ENABLE_PROFILER
+#include "Profiler.h"
+#endif
+
+namespace {
+
+const uint8_t COMMAND_LINE_MAX = 96;
+
+char line[COMMAND_LINE_MAX];
+uint8_t lineLength = 0;
+
+void runCommand(AnimationManager& manager) {
+    (void)manager; // Unused when only the profiler is built
+    if (lineLength == 0) return;
+#if ENABLE_FRAME_EXPORT
+    if (FrameExport::handle(manager, line)) return;
+#endif
+#if ENABLE_PROFILER
+    if (Profiler::handle(line)) return;
+#endif
+    Serial.print(F("[WARNING] Unknown command: ")); Serial.println(line);
+}
+
+} // namespace
+
+namespace SerialCommands {
+
+void poll(AnimationManager& manager) {
+    while (Serial.available() > 0) {
+        const char c = Serial.read();
+        if (c == '\r') continue;
+        if (c == '\n') {
+            line[lineLength] = '\0';
+            runCommand(manager);
+            lineLength = 0;
+        } else if (lineLength < COMMAND_LINE_MAX - 1) {
+            line[lineLength++] = c;
+        }
+    }
+}
+
+} // namespace SerialCommands
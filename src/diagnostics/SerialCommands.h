@@ -0,0 +1,19 @@
+/**
+ * Serial Commands
+ * Reads newline-terminated commands from Serial without blocking and hands
+ * each one to the diagnostics that are built in (FrameExport, Profiler).
+ * Only compiled in when one of them is enabled in Config.h.
+ */
+#ifndef SERIAL_COMMANDS_H
+#define SERIAL_COMMANDS_H
+
+#include <Arduino.h>
+
+class AnimationManager;
+
+namespace SerialCommands {
+    // Runs any complete command waiting on Serial; call from loop()
+    void poll(AnimationManager& manager);
+}
+
+#endif // SERIAL_COMMANDS_H
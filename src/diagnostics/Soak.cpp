@@ -0,0 +1,260 @@
+/**
+ * Soak Run Implementation
+ *
+ * One step is SOAK_STEP_MS of virtual time and one AnimationManager::update().
+ * update() clamps the frame delta, so animations still see ordinary frames;
+ * only the shuffle timers, which read frame.nowMs, see the long step. Events
+ * are rolled from a fixed seed, so two soak runs of the same build perform
+ * the same operations.
+ *
+ * Counting replaces the global operator new/delete while ENABLE_SOAK is set.
+ * It sees every task's allocations, not only the animation loop's, the same
+ * as the heap does.
+ */
+#include "Soak.h"
+#include <FastLED.h>
+#include <new>
+#include <esp_heap_caps.h>
+#include "../animations/AnimationManager.h"
+#include "../config/Config.h"
+
+namespace {
+
+const uint32_t SOAK_STEP_MS = 1000;
+const uint32_t STEPS_PER_HOUR = 3600000UL / SOAK_STEP_MS;
+const uint16_t SOAK_SEED = 0x50AC;
+const uint16_t SOAK_LED_COUNTS[] = {1, 7, 150, 300, 600, MAX_LEDS};
+
+// Thresholds shared with logHeapStackUsage()
+const uint32_t HEAP_CRITICAL = 10000;
+const uint32_t HEAP_LOW = 20000;
+const uint32_t BLOCK_SMALL = 5000;
+
+// Allocation counters, only moved while counting is set
+volatile bool counting = false;
+uint32_t allocCount = 0;
+uint32_t freeCount = 0;
+int32_t liveBytes = 0;
+int32_t peakLiveBytes = 0;
+
+uint32_t virtualNowMs = 0;
+unsigned long virtualClock() { return virtualNowMs; }
+
+enum Op : uint8_t { FRAME, SHUFFLE, NEXT_PATTERN, SET_PATTERN, SET_NUM_LEDS, SET_BRIGHTNESS, TRIGGER, OP_COUNT };
+const char* const OP_NAMES[OP_COUNT] = {"frame", "shuffle", "next_pattern", "set_pattern", "set_num_leds", "set_brightness", "trigger"};
+
+struct OpStats {
+    uint32_t count;
+    uint32_t allocs;
+    uint32_t frees;
+    int32_t bytes; // Net change in live bytes
+};
+
+OpStats hourOps[OP_COUNT];
+OpStats totalOps[OP_COUNT];
+
+struct HeapSample {
+    uint32_t freeBytes;
+    uint32_t largest;
+    uint8_t fragPct; // 100 * (1 - largest / free)
+};
+
+HeapSample sampleHeap() {
+    HeapSample s;
+    s.freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    s.largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    s.fragPct = s.freeBytes ? 100 - (uint64_t)s.largest * 100 / s.freeBytes : 0;
+    return s;
+}
+
+void noteAlloc(void* p) {
+    if (!counting || !p) return;
+    allocCount++;
+    liveBytes += heap_caps_get_allocated_size(p);
+    if (liveBytes > peakLiveBytes) peakLiveBytes = liveBytes;
+}
+
+void noteFree(void* p) {
+    if (!counting || !p) return;
+    freeCount++;
+    liveBytes -= heap_caps_get_allocated_size(p);
+}
+
+struct Counters {
+    uint32_t allocs;
+    uint32_t frees;
+    int32_t bytes;
+};
+
+Counters counters() { return {allocCount, freeCount, liveBytes}; }
+
+// Charges everything allocated since `before` to op
+void charge(Op op, const Counters& before) {
+    for (OpStats* stats : {&hourOps[op], &totalOps[op]}) {
+        stats->count++;
+        stats->allocs += allocCount - before.allocs;
+        stats->frees += freeCount - before.frees;
+        stats->bytes += liveBytes - before.bytes;
+    }
+}
+
+template <typename Fn>
+void perform(Op op, Fn fn) {
+    const Counters before = counters();
+    fn();
+    charge(op, before);
+}
+
+void printOps(const OpStats* ops) {
+    Serial.print(F("{"));
+    for (uint8_t op = 0; op < OP_COUNT; op++) {
+        if (op) Serial.print(F(","));
+        Serial.print(F("\"")); Serial.print(OP_NAMES[op]);
+        Serial.print(F("\":{\"count\":")); Serial.print(ops[op].count);
+        Serial.print(F(",\"allocs\":")); Serial.print(ops[op].allocs);
+        Serial.print(F(",\"frees\":")); Serial.print(ops[op].frees);
+        Serial.print(F(",\"bytes\":")); Serial.print(ops[op].bytes);
+        Serial.print(F("}"));
+    }
+    Serial.print(F("}"));
+}
+
+void printWarnings(uint32_t minFree, uint32_t minLargest) {
+    Serial.print(F(",\"warn\":["));
+    bool first = true;
+    auto warn = [&](const char* what) {
+        if (!first) Serial.print(F(","));
+        Serial.print(F("\"")); Serial.print(what); Serial.print(F("\""));
+        first = false;
+    };
+    if (minFree < HEAP_CRITICAL) warn("heap_critical");
+    else if (minFree < HEAP_LOW) warn("heap_low");
+    if (minLargest < BLOCK_SMALL) warn("largest_block_small");
+    Serial.print(F("]"));
+}
+
+} // namespace
+
+#if ENABLE_SOAK
+void* operator new(size_t size) {
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    noteAlloc(p);
+    return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    void* p = malloc(size ? size : 1);
+    noteAlloc(p);
+    return p;
+}
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+void operator delete(void* p) noexcept {
+    noteFree(p);
+    free(p);
+}
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+#endif
+
+namespace Soak {
+
+void run(AnimationManager& manager) {
+    Serial.println(F("=== Soak start ==="));
+    const uint8_t pattern = manager.getCurrentPatternIndex();
+    const uint16_t numLeds = manager.getNumLeds();
+    const uint8_t brightness = manager.getBrightness();
+    const uint16_t seed = manager.getRandomSeed();
+
+    manager.setPersistence(false);
+    manager.setRandomSeed(SOAK_SEED);
+    virtualNowMs = millis(); // Carry on from real time so no timer sees a jump back
+    manager.setClock(virtualClock);
+
+    // Count from a state with no animation alive, so every animation the
+    // run creates is also freed within it
+    manager.releaseAnimation();
+    const HeapSample start = sampleHeap();
+    memset(totalOps, 0, sizeof(totalOps));
+    allocCount = freeCount = 0;
+    liveBytes = peakLiveBytes = 0;
+    counting = true;
+    manager.setCurrentPattern(0); // Shuffle with random durations
+    uint32_t minFreeEver = start.freeBytes;
+
+    for (uint16_t hour = 1; hour <= SOAK_VIRTUAL_HOURS; hour++) {
+        memset(hourOps, 0, sizeof(hourOps));
+        uint32_t minFree = UINT32_MAX, minLargest = UINT32_MAX;
+        uint8_t maxFrag = 0;
+
+        for (uint32_t step = 0; step < STEPS_PER_HOUR; step++) {
+            virtualNowMs += SOAK_STEP_MS;
+            // A frame that swapped animations is charged to shuffle
+            const char* showing = manager.getCurrentAnimationName();
+            const Counters before = counters();
+            manager.update();
+            const bool shuffled = manager.inShuffleMode() && manager.getCurrentAnimationName() != showing;
+            charge(shuffled ? SHUFFLE : FRAME, before);
+
+            // Button presses and settings changes at roughly human rates
+            if (random16(30) == 0) perform(TRIGGER, [&] { manager.trigger(); });
+            if (random16(900) == 0) perform(NEXT_PATTERN, [&] { manager.nextPattern(); });
+            if (random16(1800) == 0) perform(SET_PATTERN, [&] { manager.setCurrentPattern(random8(4)); });
+            if (random16(3600) == 0) {
+                const uint16_t count = SOAK_LED_COUNTS[random8(sizeof(SOAK_LED_COUNTS) / sizeof(SOAK_LED_COUNTS[0]))];
+                perform(SET_NUM_LEDS, [&] { manager.setNumLeds(count); });
+            }
+            if (random16(600) == 0) perform(SET_BRIGHTNESS, [&] { manager.setBrightness(random8(MIN_BRIGHTNESS, MAX_BRIGHTNESS)); });
+
+            const HeapSample now = sampleHeap();
+            minFree = min(minFree, now.freeBytes);
+            minLargest = min(minLargest, now.largest);
+            maxFrag = max(maxFrag, now.fragPct);
+            yield();
+        }
+        minFreeEver = min(minFreeEver, minFree);
+
+        const HeapSample now = sampleHeap();
+        Serial.print(F("[SOAK] {\"hour\":")); Serial.print(hour);
+        Serial.print(F(",\"free\":")); Serial.print(now.freeBytes);
+        Serial.print(F(",\"min_free\":")); Serial.print(minFree);
+        Serial.print(F(",\"largest\":")); Serial.print(now.largest);
+        Serial.print(F(",\"min_largest\":")); Serial.print(minLargest);
+        Serial.print(F(",\"frag_pct\":")); Serial.print(now.fragPct);
+        Serial.print(F(",\"max_frag_pct\":")); Serial.print(maxFrag);
+        Serial.print(F(",\"live_bytes\":")); Serial.print(liveBytes);
+        Serial.print(F(",\"peak_live_bytes\":")); Serial.print(peakLiveBytes);
+        Serial.print(F(",\"ops\":")); printOps(hourOps);
+        printWarnings(minFree, minLargest);
+        Serial.println(F("}"));
+    }
+
+    // Back to no animation; anything still live now leaked
+    manager.releaseAnimation();
+    const int32_t leakedBytes = liveBytes;
+    counting = false;
+
+    manager.setClock(millis);
+    manager.setNumLeds(numLeds);
+    manager.setBrightness(brightness);
+    manager.setRandomSeed(seed);
+    manager.setCurrentPattern(pattern);
+    manager.setPersistence(true);
+
+    const HeapSample end = sampleHeap();
+    Serial.print(F("[SOAK] {\"summary\":true,\"hours\":")); Serial.print(SOAK_VIRTUAL_HOURS);
+    Serial.print(F(",\"start_free\":")); Serial.print(start.freeBytes);
+    Serial.print(F(",\"end_free\":")); Serial.print(end.freeBytes);
+    Serial.print(F(",\"peak_used\":")); Serial.print(start.freeBytes - minFreeEver);
+    Serial.print(F(",\"start_frag_pct\":")); Serial.print(start.fragPct);
+    Serial.print(F(",\"end_frag_pct\":")); Serial.print(end.fragPct);
+    Serial.print(F(",\"leaked_bytes\":")); Serial.print(leakedBytes);
+    Serial.print(F(",\"allocs\":")); Serial.print(allocCount);
+    Serial.print(F(",\"frees\":")); Serial.print(freeCount);
+    Serial.print(F(",\"ops\":")); printOps(totalOps);
+    Serial.println(F("}"));
+    Serial.println(F("=== Soak done ==="));
+}
+
+} // namespace Soak
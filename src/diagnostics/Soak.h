@@ -0,0 +1,26 @@
+/**
+ * Soak Run
+ * Compresses days of overnight use into minutes at boot: shuffle mode
+ * swapping animations, button presses, pattern picks and LED-count changes,
+ * all driven through AnimationManager on a virtual clock. Every heap
+ * allocation is counted while it runs, and each virtual hour prints the
+ * free heap, the largest free block, fragmentation and the allocations per
+ * kind of operation as one "[SOAK] " JSON line, with the same thresholds
+ * logHeapStackUsage() warns about.
+ * Enable with ENABLE_SOAK in Config.h. Settings are not saved to flash
+ * during the run, and the strip is not shown.
+ */
+#ifndef SOAK_H
+#define SOAK_H
+
+#include <Arduino.h>
+
+class AnimationManager;
+
+namespace Soak {
+    // Runs SOAK_VIRTUAL_HOURS of simulated use, then puts the pattern, LED
+    // count, brightness and clock back the way they were
+    void run(AnimationManager& manager);
+}
+
+#endif // SOAK_H
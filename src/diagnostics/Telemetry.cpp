@@ -0,0 +1,156 @@
+/**
+ * Telemetry Implementation
+ *
+ * Frame times are kept as the last FRAME_SAMPLES of the interval and sorted
+ * when the record is built; at the default 1s interval that covers every
+ * frame. Render time is held until the next show, which completes the
+ * frame. Times over 65535us are clamped. The first interval starts at the
+ * first poll(), so setup() doesn't count against it.
+ */
+#include "Telemetry.h"
+#include <FastLED.h>
+#include <algorithm>
+#include <esp_heap_caps.h>
+#include "../animations/AnimationManager.h"
+#include "../config/Config.h"
+
+namespace {
+
+const uint16_t FRAME_SAMPLES = 256;
+const uint16_t RECORD_BYTES = sizeof(Telemetry::Record) + 2; // Plus CRC
+const uint32_t SUPPLY_MV = 5000;
+
+uint16_t frameUs[FRAME_SAMPLES];
+uint16_t sorted[FRAME_SAMPLES];
+uint32_t frameCount = 0;
+uint32_t renderUs = 0;  // Rendered since the last show
+uint32_t busyUs = 0;
+uint32_t showCount = 0;
+uint32_t showUsTotal = 0;
+uint32_t showUsMax = 0;
+uint32_t intervalStartUs = 0;
+uint32_t lastRecordMs = 0;
+uint16_t sequence = 0;
+bool started = false;
+
+uint16_t clampU16(uint32_t value) { return value > 0xFFFF ? 0xFFFF : value; }
+
+// CRC-16/CCITT-FALSE: poly 0x1021, init 0xFFFF
+uint16_t crc16(const uint8_t* data, uint16_t length) {
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// Consistent Overhead Byte Stuffing; out needs length + 1 bytes (length < 254)
+uint16_t cobsEncode(const uint8_t* in, uint16_t length, uint8_t* out) {
+    uint16_t codeAt = 0, written = 1;
+    uint8_t code = 1;
+    for (uint16_t i = 0; i < length; i++) {
+        if (in[i] == 0) {
+            out[codeAt] = code;
+            codeAt = written++;
+            code = 1;
+        } else {
+            out[written++] = in[i];
+            code++;
+        }
+    }
+    out[codeAt] = code;
+    return written;
+}
+
+uint16_t percentile(uint16_t count, uint8_t pct) {
+    return count ? sorted[(uint32_t)(count - 1) * pct / 100] : 0;
+}
+
+void send(const Telemetry::Record& record) {
+    uint8_t raw[RECORD_BYTES];
+    memcpy(raw, &record, sizeof(record));
+    const uint16_t crc = crc16(raw, sizeof(record));
+    raw[sizeof(record)] = crc & 0xFF;
+    raw[sizeof(record) + 1] = crc >> 8;
+
+    // Delimiters on both sides: text printed since the last record ends up
+    // in a frame of its own instead of corrupting this one
+    uint8_t framed[RECORD_BYTES + 3];
+    framed[0] = 0;
+    const uint16_t length = cobsEncode(raw, RECORD_BYTES, framed + 1);
+    framed[length + 1] = 0;
+    Serial.write(framed, length + 2);
+}
+
+} // namespace
+
+namespace Telemetry {
+
+void recordRender(uint32_t us) {
+    renderUs += us;
+}
+
+void recordShow(uint32_t us) {
+    showCount++;
+    showUsTotal += us;
+    if (us > showUsMax) showUsMax = us;
+
+    const uint32_t spanUs = renderUs + us;
+    frameUs[frameCount % FRAME_SAMPLES] = clampU16(spanUs);
+    frameCount++;
+    busyUs += spanUs;
+    renderUs = 0;
+}
+
+void poll(AnimationManager& manager) {
+    const uint32_t nowMs = millis();
+    if (!started) {
+        started = true;
+        frameCount = busyUs = showCount = showUsTotal = showUsMax = 0;
+        intervalStartUs = micros();
+        lastRecordMs = nowMs;
+        return;
+    }
+    if (nowMs - lastRecordMs < TELEMETRY_INTERVAL_MS) return;
+    const uint32_t nowUs = micros();
+    const uint32_t elapsedMs = nowMs - lastRecordMs;
+    const uint32_t elapsedUs = nowUs - intervalStartUs;
+
+    const uint16_t samples = min(frameCount, (uint32_t)FRAME_SAMPLES);
+    memcpy(sorted, frameUs, samples * sizeof(uint16_t));
+    std::sort(sorted, sorted + samples);
+
+    Record record;
+    record.version = RECORD_VERSION;
+    record.pattern = manager.getCurrentPatternIndex();
+    record.sequence = sequence++;
+    record.uptimeMs = nowMs;
+    record.fpsX10 = clampU16(elapsedMs ? showCount * 10000UL / elapsedMs : 0);
+    record.frameUsP50 = percentile(samples, 50);
+    record.frameUsP95 = percentile(samples, 95);
+    record.frameUsP99 = percentile(samples, 99);
+    record.frameUsMax = samples ? sorted[samples - 1] : 0;
+    record.showUsAvg = clampU16(showCount ? showUsTotal / showCount : 0);
+    record.showUsMax = clampU16(showUsMax);
+    record.idlePct = elapsedUs && busyUs < elapsedUs ? 100 - (uint64_t)busyUs * 100 / elapsedUs : 0;
+    record.brightness = manager.getBrightness();
+    record.heapFree = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    record.heapLargest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    const uint32_t unscaledMw = calculate_unscaled_power_mW(manager.getLEDs(), manager.getNumLeds());
+    record.milliamps = clampU16(unscaledMw * manager.getBrightness() / 255 * 1000 / SUPPLY_MV);
+    record.numLeds = manager.getNumLeds();
+    send(record);
+
+    frameCount = 0;
+    busyUs = 0;
+    showCount = 0;
+    showUsTotal = 0;
+    showUsMax = 0;
+    intervalStartUs = nowUs;
+    lastRecordMs = nowMs;
+}
+
+} // namespace Telemetry
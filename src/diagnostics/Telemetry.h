@@ -0,0 +1,54 @@
+/**
+ * Telemetry
+ * Compact binary status stream, in place of the periodic human-readable
+ * status lines. Every TELEMETRY_INTERVAL_MS the loop emits one fixed-size
+ * Record covering that interval: frame rate, frame time percentiles, show
+ * time, idle share, heap, estimated current and the current pattern. A
+ * frame's time is its render (AnimationManager::update()) plus the
+ * FastLED.show() that puts it out, even when the two land in different
+ * passes of loop().
+ * Records end with a CRC-16/CCITT-FALSE and are COBS-framed with a zero
+ * byte before and after each, so text that still gets printed lands in a
+ * frame of its own and the decoder skips it. tools/decode_telemetry.py turns a capture into CSV.
+ * Enable with ENABLE_TELEMETRY in Config.h.
+ */
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+class AnimationManager;
+
+namespace Telemetry {
+    const uint8_t RECORD_VERSION = 2;
+
+    // Little-endian, packed; keep tools/decode_telemetry.py in step
+    struct __attribute__((packed)) Record {
+        uint8_t version;
+        uint8_t pattern;        // Current pattern index
+        uint16_t sequence;      // Counts up per record; gaps mean lost records
+        uint32_t uptimeMs;
+        uint16_t fpsX10;        // Frames shown per second, x10
+        uint16_t frameUsP50;    // Frame time percentiles over the interval
+        uint16_t frameUsP95;
+        uint16_t frameUsP99;
+        uint16_t frameUsMax;
+        uint16_t showUsAvg;     // FastLED.show() time
+        uint16_t showUsMax;
+        uint8_t idlePct;        // Share of the interval outside frame work
+        uint8_t brightness;
+        uint32_t heapFree;
+        uint32_t heapLargest;
+        uint16_t milliamps;     // Estimated strip current at 5V
+        uint16_t numLeds;
+    };
+
+    // One AnimationManager::update() call
+    void recordRender(uint32_t us);
+    // One FastLED.show() call; closes the frame rendered since the last one
+    void recordShow(uint32_t us);
+    // Sends a record once the interval has passed; call from loop()
+    void poll(AnimationManager& manager);
+}
+
+#endif // TELEMETRY_H
@@ -18,6 +18,7 @@
 #include "../animations/AnimationManager.h"
 #include "../system/SystemManager.h"
 #include "../config/PinConfig.h"
+#include "../diagnostics/Profiler.h"
 
 // Display constants
 #define OLED_RESET U8X8_PIN_NONE
@@ -57,6 +58,7 @@ void OLEDManager::begin() {
 }
 
 void OLEDManager::update() {
+    PROFILE_ZONE("oled.update");
     bool skipOledUpdate = false;
 
     if (!available) {
@@ -116,7 +118,9 @@ void OLEDManager::update() {
 
 
             u8g2.sendBuffer();
+            #if ENABLE_STATUS_LOGS
             EVERY_N_SECONDS(20) { Serial.println(F("DEBUG: OLEDManager::update() completed successfully")); }
+            #endif
         }
     }
 }
@@ -0,0 +1,56 @@
+/**
+ * Host Build Entry Point
+ * Runs the board-independent diagnostics on a desktop, through the native
+ * build and the Arduino shim in host/shim:
+ *
+ *   pio run -e native
+ *   .pio/build/native/program golden > golden.log
+ *   .pio/build/native/program export 300 60 24301 420000 0 120 Liquid Dream
+ *
+ * golden: the GoldenFrames check; exits non-zero when it fails. Its log
+ * goes to tools/approve_golden.py like one saved from a board.
+ * list, export: the FrameExport commands, with the same arguments and
+ * output as over Serial; tools/export_frames.py --host runs them.
+ */
+#include <Arduino.h>
+#include <FastLED.h>
+#include <string>
+#include "../system/SystemManager.h"
+#include "../animations/AnimationManager.h"
+#include "../diagnostics/GoldenFrames.h"
+#include "../diagnostics/FrameExport.h"
+
+int main(int argc, char** argv) {
+    const bool golden = argc == 2 && strcmp(argv[1], "golden") == 0;
+    const bool exporting = argc >= 2 && (strcmp(argv[1], "list") == 0 || strcmp(argv[1], "export") == 0);
+    if (!golden && !exporting) {
+        fprintf(stderr, "usage: %s golden | list | export <leds> <fps> <seed> <start_ms> <step_ms> <frames> <name>\n", argv[0]);
+        return 2;
+    }
+
+    Serial.print(F("FastLED version: ")); Serial.println(FASTLED_VERSION);
+    SystemManager systemManager;
+    systemManager.begin();
+    AnimationManager* manager = systemManager.getAnimationManager();
+    if (!manager || !manager->isReady()) {
+        Serial.println(F("ERROR: AnimationManager not ready"));
+        return 1;
+    }
+    manager->setPersistence(false);
+
+    if (exporting) {
+        // Rejoin the arguments into the command line the board would read
+        std::string line = argv[1];
+        for (int i = 2; i < argc; i++) {
+            line += ' ';
+            line += argv[i];
+        }
+        FrameExport::handle(*manager, line.c_str());
+        Serial.flush();
+        return 0;
+    }
+
+    const uint16_t failures = GoldenFrames::runAll(*manager);
+    Serial.flush();
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * Host Arduino Shim
+ * The slice of the Arduino core the animation code uses, for the native
+ * build ([env:native] in platformio.ini). Serial goes to stdout and time is
+ * a monotonic clock; pins, the watchdog and flash storage do nothing.
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define F(text) (text)
+#define DEC 10
+#define HEX 16
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::min;
+using std::max;
+
+class String : public std::string {
+public:
+    String(const char* text = "") : std::string(text ? text : "") {}
+    String(const std::string& text) : std::string(text) {}
+};
+
+class HardwareSerial {
+public:
+    void begin(unsigned long) {}
+    operator bool() const { return true; }
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() { fflush(stdout); }
+
+    size_t write(uint8_t byte) { return fwrite(&byte, 1, 1, stdout); }
+    size_t write(const uint8_t* data, size_t length) { return fwrite(data, 1, length, stdout); }
+
+    size_t print(const char* text) { return fputs(text, stdout) < 0 ? 0 : strlen(text); }
+    size_t print(const String& text) { return print(text.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char value, int base = DEC) { return printUnsigned(value, base); }
+    size_t print(int value, int base = DEC) { return printSigned(value, base); }
+    size_t print(unsigned int value, int base = DEC) { return printUnsigned(value, base); }
+    size_t print(long value, int base = DEC) { return printSigned(value, base); }
+    size_t print(unsigned long value, int base = DEC) { return printUnsigned(value, base); }
+    size_t print(long long value, int base = DEC) { return printSigned(value, base); }
+    size_t print(unsigned long long value, int base = DEC) { return printUnsigned(value, base); }
+    size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+
+    size_t println() { return print("\r\n"); }
+    template <typename T> size_t println(const T& value) { return print(value) + println(); }
+    template <typename T> size_t println(const T& value, int format) { return print(value, format) + println(); }
+
+private:
+    size_t printUnsigned(unsigned long long value, int base);
+    size_t printSigned(long long value, int base);
+};
+
+extern HardwareSerial Serial;
+
+struct EspClass {
+    uint32_t getFreeHeap() { return 0; }
+};
+
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+long random(long howBig);
+long random(long howSmall, long howBig);
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+#endif // HOST_ARDUINO_H
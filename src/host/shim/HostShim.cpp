@@ -0,0 +1,63 @@
+/**
+ * Host Arduino Shim Implementation
+ *
+ * The timing functions are weak so a FastLED stub build that brings its own
+ * keeps them.
+ */
+#include <Arduino.h>
+#include <esp_system.h>
+#include <chrono>
+#include <random>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+namespace {
+
+const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+template <typename Unit>
+unsigned long sinceBoot() {
+    return (unsigned long)std::chrono::duration_cast<Unit>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+} // namespace
+
+size_t HardwareSerial::printUnsigned(unsigned long long value, int base) {
+    if (base < 2 || base > 16) base = DEC;
+    char digits[65];
+    uint8_t length = 0;
+    do {
+        digits[length++] = "0123456789ABCDEF"[value % base];
+        value /= base;
+    } while (value);
+    for (uint8_t i = 0; i < length; i++) write((uint8_t)digits[length - 1 - i]);
+    return length;
+}
+
+size_t HardwareSerial::printSigned(long long value, int base) {
+    if (value >= 0 || base != DEC) return printUnsigned((unsigned long long)value, base);
+    return print('-') + printUnsigned(0ULL - (unsigned long long)value, base);
+}
+
+__attribute__((weak)) unsigned long millis() { return sinceBoot<std::chrono::milliseconds>(); }
+__attribute__((weak)) unsigned long micros() { return sinceBoot<std::chrono::microseconds>(); }
+__attribute__((weak)) void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+__attribute__((weak)) void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return HIGH; }
+
+long random(long howBig) { return howBig > 0 ? (long)(esp_random() % (uint32_t)howBig) : 0; }
+long random(long howSmall, long howBig) { return howSmall < howBig ? howSmall + random(howBig - howSmall) : howSmall; }
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+uint32_t esp_random() {
+    static std::mt19937 engine{std::random_device{}()};
+    return engine();
+}
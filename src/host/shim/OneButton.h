@@ -0,0 +1,21 @@
+/**
+ * Host OneButton Shim
+ * There is no button on the host; callbacks are accepted and never fire.
+ */
+#ifndef HOST_ONE_BUTTON_H
+#define HOST_ONE_BUTTON_H
+
+class OneButton {
+public:
+    typedef void (*Callback)();
+    OneButton(int, bool) {}
+    void attachClick(Callback) {}
+    void attachDoubleClick(Callback) {}
+    void attachLongPressStart(Callback) {}
+    void attachLongPressStop(Callback) {}
+    void setPressMs(int) {}
+    void setClickMs(int) {}
+    void tick() {}
+};
+
+#endif // HOST_ONE_BUTTON_H
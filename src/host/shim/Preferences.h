@@ -0,0 +1,26 @@
+/**
+ * Host Preferences Shim
+ * Nothing is stored: every read returns its default, as on a fresh board.
+ */
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+    bool begin(const char*, bool) { return true; }
+    void end() {}
+    bool clear() { return true; }
+    size_t freeEntries() { return 100; }
+    bool isKey(const char*) { return false; }
+
+    uint8_t getUChar(const char*, uint8_t defaultValue) { return defaultValue; }
+    uint16_t getUShort(const char*, uint16_t defaultValue) { return defaultValue; }
+    String getString(const char*, const char* defaultValue) { return String(defaultValue); }
+    size_t putUChar(const char*, uint8_t) { return 1; }
+    size_t putUShort(const char*, uint16_t) { return 2; }
+    size_t putString(const char*, const String& value) { return value.length(); }
+};
+
+#endif // HOST_PREFERENCES_H
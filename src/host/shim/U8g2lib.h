@@ -0,0 +1,8 @@
+/**
+ * Host U8g2 Shim
+ * Config.h includes U8g2 whenever ENABLE_OLED is set; the native build
+ * leaves the display out, so nothing from it is needed.
+ */
+#ifndef HOST_U8G2LIB_H
+#define HOST_U8G2LIB_H
+#endif // HOST_U8G2LIB_H
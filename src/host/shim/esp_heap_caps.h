@@ -0,0 +1,14 @@
+/**
+ * Host ESP-IDF heap shim: sizes are unknown on the host and read as 0.
+ */
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+
+#define MALLOC_CAP_8BIT 4
+
+inline size_t heap_caps_get_free_size(int) { return 0; }
+inline size_t heap_caps_get_largest_free_block(int) { return 0; }
+
+#endif // HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,11 @@
+/**
+ * Host ESP-IDF system shim.
+ */
+#ifndef HOST_ESP_SYSTEM_H
+#define HOST_ESP_SYSTEM_H
+
+#include <stdint.h>
+
+uint32_t esp_random();
+
+#endif // HOST_ESP_SYSTEM_H
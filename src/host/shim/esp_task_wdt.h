@@ -0,0 +1,9 @@
+/**
+ * Host ESP-IDF watchdog shim: there is no watchdog to feed.
+ */
+#ifndef HOST_ESP_TASK_WDT_H
+#define HOST_ESP_TASK_WDT_H
+
+inline void esp_task_wdt_reset() {}
+
+#endif // HOST_ESP_TASK_WDT_H
@@ -11,6 +11,22 @@
 #include <esp_task_wdt.h>
 #include <WiFi.h>
 #include <Preferences.h>
+#if ENABLE_BENCHMARKS
+#include "diagnostics/Benchmarks.h"
+#endif
+#if ENABLE_GOLDEN_FRAMES
+#include "diagnostics/GoldenFrames.h"
+#endif
+#if ENABLE_SOAK
+#include "diagnostics/Soak.h"
+#endif
+#if ENABLE_FRAME_EXPORT || ENABLE_PROFILER
+#include "diagnostics/SerialCommands.h"
+#endif
+#include "diagnostics/Profiler.h"
+#if ENABLE_TELEMETRY
+#include "diagnostics/Telemetry.h"
+#endif
 #if ENABLE_OLED
 #include "display/OLEDManager.h"
   OLEDManager oledManager;
@@ -47,6 +63,22 @@ void setup() {
 
     systemManager.begin();
 
+    #if ENABLE_BENCHMARKS
+        Benchmarks::runAll();
+    #endif
+
+    #if ENABLE_GOLDEN_FRAMES
+        if (systemManager.getAnimationManager()) {
+            GoldenFrames::runAll(*systemManager.getAnimationManager());
+        }
+    #endif
+
+    #if ENABLE_SOAK
+        if (systemManager.getAnimationManager()) {
+            Soak::run(*systemManager.getAnimationManager());
+        }
+    #endif
+
     #if ENABLE_OLED
         oledManager.setSystemManager(&systemManager);
         oledManager.begin();
@@ -128,14 +160,22 @@ void logHeapStackUsage() {
 }
 
 void loop() {
+#if ENABLE_STATUS_LOGS
   // Print a heartbeat message every few seconds
   EVERY_N_SECONDS(5) {
     Serial.println(F("Main loop running"));
   }
 
     EVERY_N_SECONDS(60) { Serial.println(F("[INFO] Main loop running - system healthy if this repeats.")); }
+#endif
     systemManager.update();
 
+#if ENABLE_FRAME_EXPORT || ENABLE_PROFILER
+    if (systemManager.getAnimationManager()) {
+        SerialCommands::poll(*systemManager.getAnimationManager());
+    }
+#endif
+
 #if ENABLE_OLED
   // Update OLED display periodically
   EVERY_N_MILLISECONDS(250) {
@@ -143,23 +183,32 @@ void loop() {
   }
 #endif
 
+#if ENABLE_STATUS_LOGS
     logHeapStackUsage();
 
     EVERY_N_SECONDS(10) {
         Serial.println(F("[INFO] About to call FastLED.show() - if you see freezes here, check wiring, power, or buffer issues."));
     }
+#endif
 
     if (millis() - lastShow >= ANIMATION_UPDATE_INTERVAL) {
         lastShow = millis();
         AnimationManager* animMgr = systemManager.getAnimationManager();
         if (animMgr && animMgr->isReady()) {
             unsigned long startTime = micros();
-            FastLED.show();
+            {
+                PROFILE_ZONE("show");
+                FastLED.show();
+            }
             unsigned long duration = micros() - startTime;
             //Serial.print(F("[DEBUG] FastLED.show() duration: "));
             //Serial.print(duration);
             //Serial.println(F(" microseconds"));
+            #if ENABLE_TELEMETRY
+            Telemetry::recordShow(duration);
+            #endif
 
+            #if ENABLE_STATUS_LOGS
             EVERY_N_SECONDS(20) {
                 CRGB* leds = animMgr->getLEDs();
                 Serial.print(F("[DEBUG] Post-show sample LED[0]: R:"));
@@ -169,6 +218,7 @@ void loop() {
                 Serial.print(F(" B:"));
                 Serial.println(leds[0].b);
             }
+            #endif
         } else {
             EVERY_N_SECONDS(10) { Serial.println(F("[CAUTION] AnimationManager not ready while loop active")); }
         }
@@ -177,5 +227,11 @@ void loop() {
         #endif
     }
 
+#if ENABLE_TELEMETRY
+    if (systemManager.getAnimationManager()) {
+        Telemetry::poll(*systemManager.getAnimationManager());
+    }
+#endif
+
     delay(5);
 }
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include "SystemManager.h"
 #include "../animations/AnimationManager.h"
 #include <esp_task_wdt.h>
+#if ENABLE_TELEMETRY
+#include "../diagnostics/Telemetry.h"
+#endif
 
 SystemManager::SystemManager() : animationManager(nullptr), leds(new CRGB[MAX_LEDS]) {
     memset(leds, 0, sizeof(CRGB) * MAX_LEDS);
@@ -63,7 +66,13 @@ void SystemManager::updateLeds() {
         lastLedUpdate = currentMillis;
         
         // Non-blocking animation update
+        #if ENABLE_TELEMETRY
+        const unsigned long renderStart = micros();
+        #endif
         animationManager->update();
+        #if ENABLE_TELEMETRY
+        Telemetry::recordRender(micros() - renderStart);
+        #endif
         lastSuccessfulUpdate = currentMillis;
     }
 
@@ -136,6 +145,14 @@ void SystemManager::handleNextPattern() {
     animationManager->nextPattern();
 }
 
+void SystemManager::handleTrigger() {
+    if (!animationManager) {
+        Serial.println(F("ERROR: Animation manager null"));
+        return;
+    }
+    animationManager->trigger();
+}
+
 void SystemManager::setCurrentPattern(uint16_t value) {
     if (!animationManager) {
         Serial.println(F("ERROR: Animation manager null"));
@@ -27,6 +27,7 @@ public:
     AnimationManager* getAnimationManager() const { return animationManager; }
 
     void handleNextPattern();
+    void handleTrigger();
     void setCurrentPattern(uint16_t value);
     void setBrightness(uint16_t value);
     void setNumLeds(uint16_t count);
@@ -0,0 +1,72 @@
+/**
+ * Fixed-Point Math Implementation
+ */
+#include "FixedMath.h"
+#include <math.h>
+
+namespace FixedMath {
+
+namespace {
+// sin(2*pi*i/256) in Q15, one extra entry so interpolation never wraps
+const int16_t SIN_TABLE[257] = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+    30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+    23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+    12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179, 6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+    0, -804, -1608, -2410, -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+    0
+};
+
+// exp(-k/8) in Q16 for k = 0..64
+const uint16_t EXP_NEG_TABLE[65] = {
+    65535, 57835, 51039, 45042, 39750, 35079, 30957, 27319, 24109, 21276, 18776, 16570, 14623,
+    12905, 11388, 10050, 8869, 7827, 6907, 6096, 5380, 4747, 4190, 3697, 3263, 2879,
+    2541, 2243, 1979, 1746, 1541, 1360, 1200, 1059, 935, 825, 728, 642, 567,
+    500, 442, 390, 344, 303, 268, 236, 209, 184, 162, 143, 127, 112,
+    99, 87, 77, 68, 60, 53, 47, 41, 36, 32, 28, 25, 22
+};
+} // namespace
+
+uint32_t turnsToPhase(float turns) {
+    // 16 bits of float fraction are all the sin table can resolve; a fraction
+    // that rounds up to 1.0 shifts out to 0, which is the same angle
+    return (uint32_t)((turns - floorf(turns)) * 65536.0f) << 16;
+}
+
+int16_t sinQ15(uint16_t angle) {
+    const uint8_t index = angle >> 8;
+    const int32_t frac = angle & 0xFF;
+    const int32_t a = SIN_TABLE[index];
+    const int32_t b = SIN_TABLE[index + 1];
+    return (int16_t)(a + (((b - a) * frac) >> 8));
+}
+
+uint16_t expNegQ16(uint32_t tQ16) {
+    // 8 table steps per unit: index is t >> 13, the low 13 bits interpolate
+    if (tQ16 >= (64UL << 13)) return 0;
+    const uint8_t index = tQ16 >> 13;
+    const int32_t frac = tQ16 & 0x1FFF;
+    const int32_t a = EXP_NEG_TABLE[index];
+    const int32_t b = EXP_NEG_TABLE[index + 1];
+    return (uint16_t)(a + (((b - a) * frac) >> 13));
+}
+
+uint16_t gaussQ16(int32_t xQ16) {
+    // Past |x| = 3 the curve is ~1e-4, below one step of any 8-bit output
+    const uint32_t ax = xQ16 < 0 ? -xQ16 : xQ16;
+    if (ax >= 3 * Q16_ONE) return 0;
+    return expNegQ16((uint32_t)(((uint64_t)ax * ax) >> 16));
+}
+
+} // namespace FixedMath
@@ -0,0 +1,45 @@
+/**
+ * Fixed-Point Math
+ * Integer replacements for the float sin/cos/exp/fmod used in per-pixel code.
+ * The ESP32-C3 has no FPU, so every float op there is a software call.
+ *
+ * Formats: Qn = value * 2^n in an integer. Angles are uint16_t turns
+ * (65536 = 360 degrees, same as FastLED's sin16), so wraparound is free.
+ */
+#ifndef FIXED_MATH_H
+#define FIXED_MATH_H
+
+#include <stdint.h>
+
+namespace FixedMath {
+    const int32_t Q16_ONE = 1L << 16;
+    const int16_t Q15_ONE = 32767;
+
+    inline int32_t toQ16(float v) { return (int32_t)(v * Q16_ONE); }
+    inline float fromQ16(int32_t v) { return (float)v / Q16_ONE; }
+    inline int32_t mulQ16(int32_t a, int32_t b) { return (int32_t)(((int64_t)a * b) >> 16); }
+
+    // Fraction of a turn as a Q32 phase; for per-frame float -> phase conversion
+    uint32_t turnsToPhase(float turns);
+
+    // sin/cos of a uint16_t angle in Q15, from a 256-entry table with linear
+    // interpolation (max error ~0.0001 of full scale)
+    int16_t sinQ15(uint16_t angle);
+    inline int16_t cosQ15(uint16_t angle) { return sinQ15(angle + 16384); }
+
+    // exp(-t) for t >= 0 in Q16, result in Q16 (1.0 saturates to 65535).
+    // Table at 1/8 steps with linear interpolation; 0 beyond t = 8.
+    uint16_t expNegQ16(uint32_t tQ16);
+
+    // exp(-x^2) for x in Q16: the bell curve used for soft pulses and heads.
+    // Max error ~0.002 of full scale.
+    uint16_t gaussQ16(int32_t xQ16);
+
+    // v mod range, always in [0, range) (fmod keeps the sign of v)
+    inline int32_t wrap(int32_t v, int32_t range) {
+        v %= range;
+        return v < 0 ? v + range : v;
+    }
+}
+
+#endif // FIXED_MATH_H
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Approve golden-frame hashes from a device or host log.
+
+Build with ENABLE_GOLDEN_FRAMES 1 and save the serial output of one boot, or
+run the host build (pio run -e native, then .pio/build/native/program golden
+> golden.log), then:
+
+    python tools/approve_golden.py boot.log                # show what would change
+    python tools/approve_golden.py boot.log --write        # approve everything
+    python tools/approve_golden.py boot.log --write --only "Rain Ripples"
+
+Rewrites src/diagnostics/GoldenTable.cpp and records the FastLED version the
+log came from. Runs that overran the strip are never approved. Entries for animations missing from the log are kept unless
+--prune is given.
+"""
+import argparse
+import json
+import os
+import re
+import sys
+
+TABLE_PATH = os.path.join(os.path.dirname(__file__), "..", "src", "diagnostics", "GoldenTable.cpp")
+ENTRY_RE = re.compile(r'\{"((?:[^"\\]|\\.)*)", (\d+), (0x[0-9a-fA-F]+)\}')
+VERSION_RE = re.compile(r"TABLE_FASTLED_VERSION = (\d+);")
+
+HEADER = """/**
+ * Golden Frames: approved hashes
+ * Generated by tools/approve_golden.py from a board or host (env:native)
+ * log; edit through the tool rather than by hand. Entries missing here
+ * report as "new" and count as failures. The hashes depend on FastLED's
+ * colour maths, which is why platformio.ini pins its version; re-approve
+ * after changing the pin.
+ */
+#include "GoldenFrames.h"
+
+const uint32_t GoldenFrames::TABLE_FASTLED_VERSION = %d;
+
+const GoldenFrames::Entry GoldenFrames::TABLE[] = {
+"""
+FOOTER = """    {nullptr, 0, 0}
+};
+"""
+
+
+def c_string(text):
+    return text.replace("\\", "\\\\").replace('"', '\\"')
+
+
+def read_table(path):
+    table = {}
+    with open(path) as f:
+        text = f.read()
+    for name, leds, value in ENTRY_RE.findall(text):
+        table[(name.replace('\\"', '"').replace("\\\\", "\\"), int(leds))] = int(value, 16)
+    version = VERSION_RE.search(text)
+    return table, int(version.group(1)) if version else 0
+
+
+def read_log(path):
+    """Returns the per-run records and the FastLED version from the summary."""
+    results, fastled = [], 0
+    with open(path, errors="replace") as f:
+        for line in f:
+            start = line.find("[GOLDEN] ")
+            if start < 0:
+                continue
+            try:
+                record = json.loads(line[start + 9:])
+            except ValueError:
+                continue
+            if record.get("summary"):
+                fastled = record.get("fastled", 0)
+            else:
+                results.append(record)
+    return results, fastled
+
+
+def write_table(path, table, fastled):
+    with open(path, "w") as f:
+        f.write(HEADER % fastled)
+        for (name, leds), value in table.items():
+            f.write('    {"%s", %d, 0x%08x},\n' % (c_string(name), leds, value))
+        f.write(FOOTER)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", help="serial log containing [GOLDEN] lines")
+    parser.add_argument("--only", action="append", metavar="ANIM", help="approve only this animation (repeatable)")
+    parser.add_argument("--write", action="store_true", help="rewrite the table instead of only reporting")
+    parser.add_argument("--prune", action="store_true", help="drop entries for animations missing from the log")
+    parser.add_argument("--table", default=TABLE_PATH, help="table to update")
+    args = parser.parse_args()
+
+    old, old_fastled = read_table(args.table)
+    results, fastled = read_log(args.log)
+    if not results:
+        sys.exit("no [GOLDEN] lines in %s" % args.log)
+    if old and old_fastled != fastled:
+        print("FastLED %s -> %s: changed hashes are expected" % (old_fastled or "unknown", fastled or "unknown"))
+
+    # Log order first (registry order), then entries the log didn't cover
+    table = {}
+    for r in results:
+        key = (r["anim"], r["leds"])
+        table[key] = old.get(key)
+    if not args.prune:
+        for key, value in old.items():
+            table.setdefault(key, value)
+
+    approved = unchanged = skipped = 0
+    for r in results:
+        key = (r["anim"], r["leds"])
+        value = int(r["hash"], 16)
+        if r["status"] == "overrun":
+            print("OVERRUN  %-36s %4d leds  pixel %s, frame %s (not approved)"
+                  % (key[0], key[1], r.get("overrun_pixel"), r.get("overrun_frame")))
+            skipped += 1
+            continue
+        if old.get(key) == value:
+            unchanged += 1
+            continue
+        if args.only and key[0] not in args.only:
+            skipped += 1
+            continue
+        before = "new" if key not in old else "0x%08x" % old[key]
+        print("APPROVE  %-36s %4d leds  %s -> 0x%08x" % (key[0], key[1], before, value))
+        table[key] = value
+        approved += 1
+
+    table = {k: v for k, v in table.items() if v is not None}
+    print("%d approved, %d unchanged, %d skipped" % (approved, unchanged, skipped))
+    if args.write:
+        write_table(args.table, table, fastled)
+        print("wrote %s" % os.path.normpath(args.table))
+    elif approved:
+        print("dry run; pass --write to update the table")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""
+Compare two benchmark logs.
+
+Build with ENABLE_BENCHMARKS 1 and save the serial output of a boot before and
+after a change, then:
+
+    python tools/compare_bench.py before.log after.log
+    python tools/compare_bench.py before.log after.log --suite primitives --threshold 3
+
+Lines are matched on the suite, every text field and the size parameters
+(leds, elements, ...). Timings (us_* and ns_* fields) are compared; when a
+log has several runs of the same line the median is used. Accuracy fields
+(mae, max_err, mismatches) are shown when they change. Exits with status 1
+when any timing got slower by more than the threshold.
+"""
+import argparse
+import json
+import statistics
+import sys
+
+PARAMS = {"leds", "elements", "scale", "octaves", "particles", "sources", "comets",
+          "blends", "stride", "samples", "bright"}
+ACCURACY = {"mae", "max_err", "mismatches"}
+DERIVED = {"us_saved", "ns_per_element"}  # Worked out from other timings
+
+
+def is_timing(field):
+    return (field.startswith("us_") or field.startswith("ns_")) and field not in DERIVED
+
+
+def identity(record):
+    parts = [("suite", record.get("suite", ""))]
+    for field in sorted(record):
+        value = record[field]
+        if field == "suite":
+            continue
+        if isinstance(value, str) or field in PARAMS:
+            parts.append((field, value))
+    return tuple(parts)
+
+
+def label(key):
+    return " ".join(str(v) if f == "suite" else "%s=%s" % (f, v) for f, v in key if v != "")
+
+
+def read_log(path, suite):
+    runs = {}
+    with open(path, errors="replace") as f:
+        for line in f:
+            start = line.find("[BENCH] {")
+            if start < 0:
+                continue
+            try:
+                record = json.loads(line[start + 8:])
+            except ValueError:
+                continue
+            if suite and record.get("suite") != suite:
+                continue
+            fields = runs.setdefault(identity(record), {})
+            for field, value in record.items():
+                if isinstance(value, (int, float)) and (is_timing(field) or field in ACCURACY):
+                    fields.setdefault(field, []).append(value)
+    return {key: {f: statistics.median(v) for f, v in fields.items()} for key, fields in runs.items()}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("before")
+    parser.add_argument("after")
+    parser.add_argument("--suite", help="only compare this suite")
+    parser.add_argument("--threshold", type=float, default=5.0, help="percent slower that counts as a regression")
+    args = parser.parse_args()
+
+    before = read_log(args.before, args.suite)
+    after = read_log(args.after, args.suite)
+    if not before or not after:
+        sys.exit("no [BENCH] lines to compare")
+
+    regressions = 0
+    for key in before:
+        if key not in after:
+            print("%-60s only in %s" % (label(key), args.before))
+            continue
+        for field, old in sorted(before[key].items()):
+            new = after[key].get(field)
+            if new is None:
+                continue
+            if field in ACCURACY:
+                if new != old:
+                    print("%-60s %-22s %10s -> %-10s accuracy changed" % (label(key), field, old, new))
+                continue
+            change = (new - old) * 100.0 / old if old else 0.0
+            mark = ""
+            if change > args.threshold:
+                mark = "SLOWER"
+                regressions += 1
+            elif change < -args.threshold:
+                mark = "faster"
+            print("%-60s %-22s %10g -> %-10g %+7.1f%% %s" % (label(key), field, old, new, change, mark))
+    for key in after:
+        if key not in before:
+            print("%-60s only in %s" % (label(key), args.after))
+
+    print("%d regression(s) over %.1f%%" % (regressions, args.threshold))
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
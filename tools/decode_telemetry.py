@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+Decode the binary telemetry stream into CSV.
+
+Build with ENABLE_TELEMETRY 1, then either capture the raw serial bytes to a
+file and decode it later, or read the port directly:
+
+    python tools/decode_telemetry.py capture.bin night.csv
+    python tools/decode_telemetry.py --port /dev/ttyACM0 night.csv
+
+Records are COBS-framed with a zero byte before and after each and end in a
+CRC-16/CCITT-FALSE; anything else on the line (boot messages, errors) falls
+between records, fails the check and is skipped. Skipped frames and gaps in the sequence number are
+counted on stderr. Reading a port needs pyserial (pip install pyserial);
+stop with Ctrl-C.
+"""
+import argparse
+import csv
+import struct
+import sys
+
+# Matches Telemetry::Record in src/diagnostics/Telemetry.h
+RECORD = struct.Struct("<BBHIHHHHHHHBBIIHH")
+RECORD_VERSION = 2
+FIELDS = ("version", "pattern", "sequence", "uptime_ms", "fps_x10",
+          "frame_us_p50", "frame_us_p95", "frame_us_p99", "frame_us_max",
+          "show_us_avg", "show_us_max", "idle_pct", "brightness",
+          "heap_free", "heap_largest", "milliamps", "num_leds")
+COLUMNS = ("uptime_s", "fps") + tuple(f for f in FIELDS if f not in ("version", "uptime_ms", "fps_x10"))
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(frame):
+    out, i = bytearray(), 0
+    while i < len(frame):
+        code = frame[i]
+        if code == 0 or i + code > len(frame) + 1:
+            return None
+        out += frame[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+def parse(frame):
+    """Returns a record dict, or None when the frame is not a valid record."""
+    data = cobs_decode(frame)
+    if data is None or len(data) != RECORD.size + 2:
+        return None
+    body, (crc,) = data[:-2], struct.unpack("<H", data[-2:])
+    if crc16(body) != crc:
+        return None
+    record = dict(zip(FIELDS, RECORD.unpack(body)))
+    if record["version"] != RECORD_VERSION:
+        return None
+    return record
+
+
+def frames(stream, live):
+    """Yields the bytes between zero delimiters; a live port never runs dry."""
+    pending = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if live:
+                continue
+            return
+        pending += chunk
+        while True:
+            end = pending.find(b"\0")
+            if end < 0:
+                break
+            yield bytes(pending[:end])
+            del pending[:end + 1]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", nargs="?", help="raw capture file (omit with --port)")
+    parser.add_argument("csv", help="output file, - for stdout")
+    parser.add_argument("--port")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+    if bool(args.capture) == bool(args.port):
+        parser.error("give a capture file or --port, not both")
+
+    if args.port:
+        import serial  # pyserial; imported late so files decode without it
+        stream = serial.Serial(args.port, args.baud, timeout=1)
+    else:
+        stream = open(args.capture, "rb")
+
+    out = sys.stdout if args.csv == "-" else open(args.csv, "w", newline="")
+    writer = csv.writer(out)
+    writer.writerow(COLUMNS)
+    good = bad = gaps = 0
+    last_sequence = None
+    try:
+        for frame in frames(stream, bool(args.port)):
+            if not frame:
+                continue
+            record = parse(frame)
+            if record is None:
+                bad += 1
+                continue
+            good += 1
+            if last_sequence is not None and record["sequence"] != (last_sequence + 1) & 0xFFFF:
+                gaps += 1
+            last_sequence = record["sequence"]
+            record["uptime_s"] = "%.3f" % (record["uptime_ms"] / 1000)
+            record["fps"] = "%.1f" % (record["fps_x10"] / 10)
+            writer.writerow([record[c] for c in COLUMNS])
+            out.flush()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        stream.close()
+        if out is not sys.stdout:
+            out.close()
+    print("%d records, %d skipped frames, %d sequence gaps" % (good, bad, gaps), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
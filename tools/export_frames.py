@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+Export animation frames without watching the strip.
+
+The frames come from the native build (pio run -e native), which renders
+them on the desktop, or from a board built with ENABLE_FRAME_EXPORT 1 and
+connected over USB. Both take the same commands and give the same frames:
+
+    python tools/export_frames.py --host .pio/build/native/program --list
+    python tools/export_frames.py --host .pio/build/native/program "Liquid Dream" --leds 300 \\
+        --start 7m --frames 120 --format ppm --out liquid.ppm
+    python tools/export_frames.py --port /dev/ttyACM0 "Liquid Dream" --format ansi
+    python tools/export_frames.py --port /dev/ttyACM0 "Liquid Dream" --format raw --out - | other-tool
+
+The animation renders the animation on a virtual clock from a fixed seed, so the
+same arguments give the same frames. --start fast-forwards first; --warp-step
+renders that stretch in coarser steps (e.g. 1s) to get through hours quickly,
+at the cost of matching a real run less closely. Those steps reach the
+animation as they are: a running board never hands update() more than
+MAX_FRAME_DELTA_MS (100 ms), because AnimationManager clamps it, so warp
+steps above that exercise deltas real use never produces. A warp never
+takes more than 100000 steps; longer ones get a larger step, which the
+header reports.
+
+Formats:
+    ppm   one image per run, a row per frame and a column per LED
+    ansi  true-colour terminal preview, played back at the frame rate
+    raw   leds * 3 bytes of RGB per frame, back to back
+--port needs pyserial (pip install pyserial).
+"""
+import argparse
+import json
+import re
+import struct
+import subprocess
+import sys
+import time
+
+PREFIX = "[EXPORT] "
+FRAME_MAGIC = b"FX"
+UNITS_MS = {"ms": 1, "s": 1000, "m": 60000, "h": 3600000}
+
+
+def parse_duration(text):
+    """'90s', '7m', '2h30m', '1500ms' or a bare number of milliseconds."""
+    if text.isdigit():
+        return int(text)
+    parts = re.findall(r"(\d+(?:\.\d+)?)(ms|s|m|h)", text)
+    if not parts or "".join(n + u for n, u in parts) != text:
+        raise argparse.ArgumentTypeError("bad duration: " + text)
+    return int(sum(float(n) * UNITS_MS[u] for n, u in parts))
+
+
+def read_record(port):
+    """Skips ordinary log lines and returns the next [EXPORT] record."""
+    while True:
+        raw = port.readline()
+        if not raw:
+            raise SystemExit("no reply from the exporter")
+        text = raw.decode("utf-8", "replace").strip()
+        if text.startswith(PREFIX):
+            record = json.loads(text[len(PREFIX):])
+            if "error" in record:
+                raise SystemExit("exporter: " + record["error"])
+            return record
+
+
+def read_exact(port, count):
+    data = port.read(count)
+    if len(data) != count:
+        raise SystemExit("frame stream cut short")
+    return data
+
+
+def read_frames(port, header):
+    """Yields (index, now_ms, rgb bytes) for each frame in the stream."""
+    size = header["leds"] * 3
+    for _ in range(header["frames"]):
+        # Resync on the magic in case a stray log line slipped in
+        window = b""
+        while window != FRAME_MAGIC:
+            window = (window + read_exact(port, 1))[-2:]
+        index, now_ms = struct.unpack("<II", read_exact(port, 8))
+        yield index, now_ms, read_exact(port, size)
+
+
+def write_ppm(out, leds, rows):
+    out.write(b"P6\n%d %d\n255\n" % (leds, len(rows)))
+    for row in rows:
+        out.write(row)
+
+
+def ansi_row(rgb):
+    cells = []
+    for i in range(0, len(rgb), 3):
+        r, g, b = rgb[i], rgb[i + 1], rgb[i + 2]
+        cells.append("\x1b[48;2;%d;%d;%dm " % (r, g, b))
+    return "".join(cells) + "\x1b[0m"
+
+
+def stream_frames(port, args, header):
+    out = sys.stdout.buffer if args.out == "-" else open(args.out, "wb")
+    try:
+        rows = []
+        period = 1.0 / args.fps
+        for index, now_ms, rgb in read_frames(port, header):
+            if args.format == "raw":
+                out.write(rgb)
+            elif args.format == "ppm":
+                rows.append(rgb)
+            else:
+                line = ansi_row(rgb) + " %8.2fs\n" % (now_ms / 1000)
+                out.write(("\r\x1b[1A" if index else "").encode() + line.encode())
+                out.flush()
+                time.sleep(period)
+        if args.format == "ppm":
+            write_ppm(out, header["leds"], rows)
+    finally:
+        if out is not sys.stdout.buffer:
+            out.close()
+
+
+def print_header(header):
+    print("%s: %d frames of %d LEDs from %.1fs, %d ms warp steps (fast-forward took %.1fs)" % (
+        header["anim"], header["frames"], header["leds"], header["start_ms"] / 1000,
+        header["step_ms"], header["warp_ms"] / 1000), file=sys.stderr)
+
+
+def print_list(port):
+    while True:
+        record = read_record(port)
+        if record.get("done"):
+            return
+        print("%3d  %s" % (record["index"], record["name"]))
+
+
+def export_args(args):
+    return ["%d" % value for value in
+            (args.leds, args.fps, args.seed, args.start, args.warp_step, args.frames)] + [args.anim]
+
+
+def run_host(args):
+    """Runs the native build once per command and reads its stdout."""
+    command = [args.host, "list"] if args.list else [args.host, "export"] + export_args(args)
+    with subprocess.Popen(command, stdout=subprocess.PIPE) as proc:
+        if args.list:
+            print_list(proc.stdout)
+        else:
+            header = read_record(proc.stdout)
+            print_header(header)
+            stream_frames(proc.stdout, args, header)
+            read_record(proc.stdout)  # Closing {"done":true}
+    return 0
+
+
+def run_board(args):
+    import serial  # pyserial; imported late so --help and --host work without it
+
+    with serial.Serial(args.port, args.baud, timeout=30) as port:
+        port.reset_input_buffer()
+        if args.list:
+            port.write(b"list\n")
+            print_list(port)
+            return 0
+
+        port.write(("export " + " ".join(export_args(args)) + "\n").encode())
+        # Fast-forwarding can take a while before the header arrives
+        port.timeout = None
+        header = read_record(port)
+        port.timeout = 30
+        print_header(header)
+        stream_frames(port, args, header)
+        read_record(port)  # Closing {"done":true}
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("anim", nargs="?", help="registry name of the animation")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--host", help="native build to run (.pio/build/native/program)")
+    source.add_argument("--port", help="serial port of a board built with ENABLE_FRAME_EXPORT")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--list", action="store_true", help="print the registered animations")
+    parser.add_argument("--leds", type=int, default=300)
+    parser.add_argument("--fps", type=int, default=60)
+    parser.add_argument("--seed", type=int, default=0x5EED)
+    parser.add_argument("--start", type=parse_duration, default=0, help="virtual time to skip first")
+    parser.add_argument("--warp-step", type=parse_duration, default=0,
+                        help="virtual time per fast-forward frame (default: one frame period); "
+                             "steps over 100ms are deltas a running board never produces")
+    parser.add_argument("--frames", type=int, default=60)
+    parser.add_argument("--format", choices=("ppm", "ansi", "raw"), default="ansi")
+    parser.add_argument("--out", default="-", help="output file, - for stdout")
+    args = parser.parse_args()
+    if not args.list and not args.anim:
+        parser.error("name an animation or pass --list")
+    return run_host(args) if args.host else run_board(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
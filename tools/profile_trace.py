@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Convert a profiler dump into Chrome trace JSON.
+
+Build with ENABLE_PROFILER 1, let it run, send "profile" over Serial and save
+the log, then:
+
+    python tools/profile_trace.py device.log trace.json
+    python tools/profile_trace.py device.log trace.json --all
+
+Open trace.json in chrome://tracing or https://ui.perfetto.dev. Zones nest
+the way they did in the code. A per-zone summary (count, mean, max, total)
+is printed to stderr. Only the last dump in the log is used unless --all is
+given, in which case each dump becomes its own process row.
+
+The cycle counter wraps every few tens of seconds; events come out of the
+ring in the order they ended, which is enough to unwrap it.
+"""
+import argparse
+import json
+import sys
+from collections import defaultdict
+
+PREFIX = "[PROFILE] "
+WRAP = 1 << 32
+
+
+def read_dumps(path):
+    """Returns a list of (header, events) for every complete dump in the log."""
+    dumps, current = [], None
+    with open(path, encoding="utf-8", errors="replace") as log:
+        for line in log:
+            at = line.find(PREFIX)
+            if at < 0:
+                continue
+            try:
+                record = json.loads(line[at + len(PREFIX):])
+            except json.JSONDecodeError:
+                continue
+            if "ticks_per_us" in record:
+                current = (record, [])
+            elif record.get("done"):
+                if current:
+                    dumps.append(current)
+                current = None
+            elif current and "zone" in record:
+                current[1].append(record)
+    return dumps
+
+
+def unwrap(events):
+    """Adds absolute start/end ticks, carrying the counter across wraps."""
+    offset, last_end = 0, None
+    for e in events:
+        end = (e["start"] + e["ticks"]) % WRAP
+        if last_end is not None and end + offset < last_end - WRAP // 2:
+            offset += WRAP
+        e["abs_end"] = end + offset
+        e["abs_start"] = e["abs_end"] - e["ticks"]
+        last_end = e["abs_end"]
+    return events
+
+
+def trace_events(dump, pid):
+    header, events = dump
+    per_us = float(header["ticks_per_us"])
+    events = unwrap(events)
+    origin = min((e["abs_start"] for e in events), default=0)
+    out = [{"name": "process_name", "ph": "M", "pid": pid, "args": {"name": "dump %d" % pid}}]
+    for e in sorted(events, key=lambda e: (e["abs_start"], e["depth"])):
+        out.append({
+            "name": e["zone"],
+            "ph": "X",
+            "pid": pid,
+            "tid": 0,
+            "ts": (e["abs_start"] - origin) / per_us,
+            "dur": e["ticks"] / per_us,
+            "args": {"depth": e["depth"]},
+        })
+    return out
+
+
+def summarize(dump, out):
+    header, events = dump
+    per_us = float(header["ticks_per_us"])
+    zones = defaultdict(list)
+    for e in events:
+        zones[e["zone"]].append(e["ticks"] / per_us)
+    print("%-28s %7s %10s %10s %12s" % ("zone", "count", "mean_us", "max_us", "total_us"), file=out)
+    for zone, times in sorted(zones.items(), key=lambda kv: -sum(kv[1])):
+        print("%-28s %7d %10.1f %10.1f %12.1f" % (
+            zone, len(times), sum(times) / len(times), max(times), sum(times)), file=out)
+    if header.get("dropped"):
+        print("(%d older events were overwritten before the dump)" % header["dropped"], file=out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log")
+    parser.add_argument("trace")
+    parser.add_argument("--all", action="store_true", help="convert every dump, not just the last")
+    args = parser.parse_args()
+
+    dumps = read_dumps(args.log)
+    if not dumps:
+        print("no complete [PROFILE] dump in " + args.log, file=sys.stderr)
+        return 1
+    chosen = dumps if args.all else dumps[-1:]
+
+    trace = []
+    for pid, dump in enumerate(chosen):
+        trace.extend(trace_events(dump, pid))
+        summarize(dump, sys.stderr)
+    with open(args.trace, "w") as out:
+        json.dump({"traceEvents": trace, "displayTimeUnit": "ms"}, out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())